@@ -111,40 +111,42 @@ static void run_loop(
         gl.bind_attrib_location(prog, cube.tangent_loc(), "Tangent");
         gl.bind_attrib_location(prog, cube.face_coord_loc(), "TexCoord");
 
-        // color texture
+        // textures
         owned_texture_name color_tex;
         gl.gen_textures() >> color_tex;
         const auto cleanup_color_tex = gl.delete_textures.raii(color_tex);
+        owned_texture_name normal_tex;
+        gl.gen_textures() >> normal_tex;
+        const auto cleanup_normal_tex = gl.delete_textures.raii(normal_tex);
+        owned_texture_name light_tex;
+        gl.gen_textures() >> light_tex;
+        const auto cleanup_light_tex = gl.delete_textures.raii(light_tex);
+
+        texture_batch_loader textures{ctx, glapi};
+        textures.add(search_resource("CrateDiff"), color_tex, GL.texture_2d)
+          .add(search_resource("CrateNMap"), normal_tex, GL.texture_2d)
+          .add(search_resource("CrateLMap"), light_tex, GL.texture_2d)
+          .load();
+
+        // color texture
         gl.active_texture(GL.texture0 + 0);
         gl.bind_texture(GL.texture_2d, color_tex);
-        build_from_resource(
-          ctx, glapi, search_resource("CrateDiff"), color_tex, GL.texture_2d);
 
         uniform_location color_tex_loc;
         gl.get_uniform_location(prog, "colorTex") >> color_tex_loc;
         glapi.set_uniform(prog, color_tex_loc, 0);
 
         // normal texture
-        owned_texture_name normal_tex;
-        gl.gen_textures() >> normal_tex;
-        const auto cleanup_normal_tex = gl.delete_textures.raii(normal_tex);
         gl.active_texture(GL.texture0 + 1);
         gl.bind_texture(GL.texture_2d, normal_tex);
-        build_from_resource(
-          ctx, glapi, search_resource("CrateNMap"), normal_tex, GL.texture_2d);
 
         uniform_location normal_tex_loc;
         gl.get_uniform_location(prog, "normalTex") >> normal_tex_loc;
         glapi.set_uniform(prog, normal_tex_loc, 1);
 
         // light texture
-        owned_texture_name light_tex;
-        gl.gen_textures() >> light_tex;
-        const auto cleanup_light_tex = gl.delete_textures.raii(light_tex);
         gl.active_texture(GL.texture0 + 2);
         gl.bind_texture(GL.texture_2d, light_tex);
-        build_from_resource(
-          ctx, glapi, search_resource("CrateLMap"), light_tex, GL.texture_2d);
 
         uniform_location light_tex_loc;
         gl.get_uniform_location(prog, "lightTex") >> light_tex_loc;
@@ -137,6 +137,15 @@ class ArgumentParser(argparse.ArgumentParser):
             default=False
         )
 
+        self.add_argument(
+            "--chunk-units", "-C",
+            metavar='INTEGER',
+            dest='chunk_units',
+            nargs='?',
+            type=_positive_int,
+            default=0
+        )
+
         self.add_argument(
             "--force-alpha", "-A",
             dest='force_alpha',
@@ -519,6 +528,34 @@ class PngImage(object):
                 pass
         return "none"
 
+# ------------------------------------------------------------------------------
+def _input_images(image0, options):
+    yield image0
+    for input_path in options.input_paths[1:]:
+        image = PngImage(options, input_path)
+        assert image.same_format_as(image0)
+        yield image
+
+# ------------------------------------------------------------------------------
+def _compressed_chunks(image0, options):
+    import zlib
+    # the units are rows of 2D images or layers of 3D images
+    units = []
+    for img in _input_images(image0, options):
+        units.append(b"".join(img.chunks()))
+    if len(units) == 1:
+        data = units[0]
+        row_size = len(data) // image0.height()
+        units = [data[i:i+row_size] for i in range(0, len(data), row_size)]
+
+    result = []
+    for i in range(0, len(units), options.chunk_units):
+        group = units[i:i+options.chunk_units]
+        zobj = zlib.compressobj(zlib.Z_BEST_COMPRESSION)
+        data = zobj.compress(b"".join(group)) + zobj.flush()
+        result.append((len(group), data))
+    return result
+
 # ------------------------------------------------------------------------------
 def convert(options):
     image0 = PngImage(options, options.input_paths[0])
@@ -550,17 +587,10 @@ def convert(options):
             except ValueError:
                 options.write(',"%s":"%s"\n' % (name, value))
 
-    def _images(image0, options):
-        yield image0
-        for input_path in options.input_paths[1:]:
-            image = PngImage(options, input_path)
-            assert image.same_format_as(image0)
-            yield image
-
     if options.write_elements:
         options.write(',"data":[')
         first_element = True
-        for img in _images(image0, options):
+        for img in _input_images(image0, options):
             for e in img.elements():
                 if first_element:
                     first_element = False
@@ -568,6 +598,17 @@ def convert(options):
                     options.write(",")
                 options.write("%d" % e)
         options.write(']')
+    elif options.gzip_data and options.chunk_units > 0:
+        # independently compressed chunks of rows or layers
+        chunks = _compressed_chunks(image0, options)
+        options.write(',"chunk_units":[%s]\n' % ",".join(
+            "%d" % units for units, data in chunks))
+        options.write(',"chunk_data_size":[%s]\n' % ",".join(
+            "%d" % len(data) for units, data in chunks))
+        options.write(',"data_filter":"zlib"}')
+        for units, data in chunks:
+            options.write(data)
+        return
     else:
         options.write(',"data_filter":"%s"' % image0.data_filter(options))
     options.write('}')
@@ -576,7 +617,7 @@ def convert(options):
             assert options.gzip_data
             import zlib
             zobj = zlib.compressobj(zlib.Z_BEST_COMPRESSION)
-            for img in _images(image0, options):
+            for img in _input_images(image0, options):
                 for chunk in img.chunks():
                     compressed = zobj.compress(chunk)
                     if compressed:
@@ -585,7 +626,7 @@ def convert(options):
             if compressed:
                 options.write(compressed)
         except:
-            for img in _images(image0, options):
+            for img in _input_images(image0, options):
                 for chunk in img.chunks():
                     options.write(chunk)
 
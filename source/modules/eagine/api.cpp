@@ -98,6 +98,89 @@ struct make_args_map<
     }
 };
 
+// binary format and data, used by ProgramBinary and ShaderBinary
+template <
+  std::size_t CI,
+  std::size_t CppI,
+  typename Format,
+  typename CTs,
+  typename CppTs>
+struct binary_format_args_map;
+
+template <
+  std::size_t CI,
+  std::size_t CppI,
+  typename Format,
+  typename... CT,
+  typename... CppT>
+struct binary_format_args_map<
+  CI,
+  CppI,
+  Format,
+  mp_list<CT...>,
+  mp_list<CppT...>>
+  : make_arg_map<CI, CppI, oglplus::gl_types::enum_type, Format>
+  , get_data_map<CI + 1, CppI + 1>
+  , convert<oglplus::gl_types::sizei_type, get_size_map<CI + 2, CppI + 1>>
+  , make_args_map<CI + 3, CppI + 2, mp_list<CT...>, mp_list<CppT...>> {
+
+    using make_arg_map<CI, CppI, oglplus::gl_types::enum_type, Format>::
+    operator();
+    using get_data_map<CI + 1, CppI + 1>::operator();
+    using convert<oglplus::gl_types::sizei_type, get_size_map<CI + 2, CppI + 1>>::
+    operator();
+    using make_args_map<CI + 3, CppI + 2, mp_list<CT...>, mp_list<CppT...>>::
+    operator();
+};
+
+template <std::size_t CI, std::size_t CppI, typename... CT, typename... CppT>
+struct make_args_map<
+  CI,
+  CppI,
+  mp_list<
+    oglplus::gl_types::enum_type,
+    const void*,
+    oglplus::gl_types::sizei_type,
+    CT...>,
+  mp_list<oglplus::program_binary_format, memory::const_block, CppT...>>
+  : binary_format_args_map<
+      CI,
+      CppI,
+      oglplus::program_binary_format,
+      mp_list<CT...>,
+      mp_list<CppT...>> {
+    using binary_format_args_map<
+      CI,
+      CppI,
+      oglplus::program_binary_format,
+      mp_list<CT...>,
+      mp_list<CppT...>>::operator();
+};
+
+template <std::size_t CI, std::size_t CppI, typename... CT, typename... CppT>
+struct make_args_map<
+  CI,
+  CppI,
+  mp_list<
+    oglplus::gl_types::enum_type,
+    const void*,
+    oglplus::gl_types::sizei_type,
+    CT...>,
+  mp_list<oglplus::shader_binary_format, memory::const_block, CppT...>>
+  : binary_format_args_map<
+      CI,
+      CppI,
+      oglplus::shader_binary_format,
+      mp_list<CT...>,
+      mp_list<CppT...>> {
+    using binary_format_args_map<
+      CI,
+      CppI,
+      oglplus::shader_binary_format,
+      mp_list<CT...>,
+      mp_list<CppT...>>::operator();
+};
+
 } // namespace eagine::c_api
 
 namespace eagine::oglplus {
@@ -873,6 +956,36 @@ public:
         c_api::get_data_map<4, 2>>>
       get_program_info_log{*this};
 
+    adapted_function<
+      &gl_api::GetProgramBinary,
+      void(program_name, enum_type*, span<byte>),
+      c_api::combined_map<
+        c_api::head_transform_map<sizei_type, 3, 3>,
+        c_api::convert<name_type, c_api::trivial_arg_map<1>>,
+        c_api::convert<sizei_type, c_api::get_size_map<2, 3>>,
+        c_api::reorder_arg_map<4, 2>,
+        c_api::get_data_map<5, 3>>>
+      get_program_binary{*this};
+
+    simple_adapted_function<
+      &gl_api::ProgramBinary,
+      void(program_name, program_binary_format, memory::const_block)>
+      program_binary{*this};
+
+    using _program_parameter_i_t = simple_adapted_function<
+      &gl_api::ProgramParameteri,
+      void(program_name, enum_parameter_value<program_parameter, int_type>)>;
+
+    struct : _program_parameter_i_t {
+        using base = _program_parameter_i_t;
+        using base::base;
+        template <typename Param, typename Value>
+        constexpr auto operator()(program_name prog, Param param, Value value)
+          const noexcept {
+            return base::operator()(prog, {param, value});
+        }
+    } program_parameter_i{*this};
+
     simple_adapted_function<&gl_api::UseProgram, void(program_name)> use_program{
       *this};
 
@@ -951,6 +1064,24 @@ public:
         c_api::get_data_map<8, 5>>>
       get_program_resource_f{*this};
 
+    adapted_function<
+      &gl_api::GetProgramResourceiv,
+      void(
+        program_name,
+        program_interface,
+        uint_type,
+        span<const enum_type>,
+        span<int_type>),
+      c_api::combined_map<
+        c_api::head_transform_map<sizei_type, 7, 5>,
+        c_api::make_arg_map<1, 1, name_type, program_name>,
+        c_api::trivial_arg_map<2, 3>,
+        c_api::convert<sizei_type, c_api::get_size_map<4, 4>>,
+        c_api::get_data_map<5, 4>,
+        c_api::convert<sizei_type, c_api::get_size_map<6, 5>>,
+        c_api::get_data_map<8, 5>>>
+      get_program_resource_iv{*this};
+
     simple_adapted_function<
       &gl_api::BindAttribLocation,
       void(program_name, vertex_attrib_location, string_view)>
@@ -2152,7 +2283,7 @@ public:
 
     simple_adapted_function<
       &gl_api::VertexArrayBindingDivisor,
-      void(vertex_buffer_binding, uint_type)>
+      void(vertex_array_name, vertex_buffer_binding, uint_type)>
       vertex_array_binding_divisor{*this};
 
     simple_adapted_function<
@@ -3613,6 +3744,27 @@ public:
       void(primitive_type, index_data_type, const_void_ptr_type)>
       draw_elements_indirect{*this};
 
+    simple_adapted_function<
+      &gl_api::MultiDrawElementsIndirect,
+      void(
+        primitive_type,
+        index_data_type,
+        const_void_ptr_type,
+        sizei_type,
+        sizei_type)>
+      multi_draw_elements_indirect{*this};
+
+    simple_adapted_function<
+      &gl_api::MultiDrawElementsIndirectCount,
+      void(
+        primitive_type,
+        index_data_type,
+        const_void_ptr_type,
+        intptr_type,
+        sizei_type,
+        sizei_type)>
+      multi_draw_elements_indirect_count{*this};
+
     simple_adapted_function<
       &gl_api::DrawElementsBaseVertex,
       void(
@@ -3792,8 +3944,44 @@ public:
         }
     }
 
+    // has_known_extension
+    /// @brief Tests if the extension at the specified index is available.
+    /// @see known_gl_extensions
+    /// @see refresh_extensions
+    ///
+    /// The list of extensions is queried from GL only on first use and
+    /// the result is cached in a bitset indexed by the known extensions.
+    /// If the list cannot be queried yet (for example without GetStringi or
+    /// before a context is current) nothing is cached and the query is
+    /// repeated on the next use.
+    auto has_known_extension(span_size_t index) const noexcept -> bool {
+        if(not _extension_cache.is_resolved()) [[unlikely]] {
+            if(this->GetStringi) {
+                if(const auto count{get_extension_count()}; count > 0) {
+                    for(const auto i : integer_range(count)) {
+                        _extension_cache.add(get_extension(i));
+                    }
+                    _extension_cache.mark_resolved();
+                }
+            }
+        }
+        return _extension_cache.has(index);
+    }
+
+    // refresh_extensions
+    /// @brief Drops the cached extension availability flags.
+    /// @see has_known_extension
+    ///
+    /// Should be called when the GL context is changed or re-created.
+    void refresh_extensions() const noexcept {
+        _extension_cache.reset();
+    }
+
     // has_extension
     auto has_extension(string_view which) const noexcept {
+        if(const auto index{find_known_gl_extension(which)}; index >= 0) {
+            return has_known_extension(index);
+        }
         for(const auto i : integer_range(get_extension_count())) {
             if(ends_with(get_extension(i), which)) {
                 return true;
@@ -3812,6 +4000,38 @@ public:
         return false;
     }
 
+    using _shader_binary_t = simple_adapted_function<
+      &gl_api::ShaderBinary,
+      void(span<const name_type>, shader_binary_format, memory::const_block)>;
+
+    struct : _shader_binary_t {
+        using base = _shader_binary_t;
+        using base::base;
+
+        constexpr auto operator()(
+          shader_name shdr,
+          shader_binary_format format,
+          memory::const_block binary) const noexcept {
+            const auto name{static_cast<name_type>(shdr)};
+            return base::operator()(view_one(name), format, binary);
+        }
+    } shader_binary{*this};
+
+    adapted_function<
+      &gl_api::SpecializeShader,
+      void(
+        shader_name,
+        string_view,
+        span<const uint_type>,
+        span<const uint_type>),
+      c_api::combined_map<
+        c_api::make_arg_map<1, 1, name_type, shader_name>,
+        c_api::make_arg_map<2, 2, const char_type*, string_view>,
+        c_api::convert<uint_type, c_api::get_size_map<3, 3>>,
+        c_api::get_data_map<4, 3>,
+        c_api::get_data_map<5, 4>>>
+      specialize_shader{*this};
+
     // named strings
     simple_adapted_function<
       &gl_api::NamedString,
@@ -4005,6 +4225,9 @@ public:
     plain_adapted_function<&gl_api::Finish> finish{*this};
 
     basic_gl_operations(api_traits& traits);
+
+private:
+    mutable gl_extension_table _extension_cache{};
 };
 //------------------------------------------------------------------------------
 template <typename ApiTraits>
@@ -4027,6 +4250,8 @@ public:
     using combined_result = typename ApiTraits::template combined_result<R>;
 
     using int_type = typename gl_types::int_type;
+    using uint_type = typename gl_types::uint_type;
+    using enum_type = typename gl_types::enum_type;
     using float_type = typename gl_types::float_type;
 
     /// @brief Constructor using API traits..
@@ -4171,6 +4396,22 @@ public:
     auto program_info_log(const program_name prog) const
       -> valid_if_not_empty<std::string>;
 
+    /// @brief Indicates if the specified shader object is compiled.
+    /// @see shader_compile_batch
+    auto is_shader_compiled(const shader_name shdr) const noexcept -> bool {
+        return this->get_shader_i(shdr, this->compile_status)
+          .transform([](auto status) { return bool(status); })
+          .value_or(false);
+    }
+
+    /// @brief Indicates if the specified program object is linked.
+    /// @see program_binary_cache
+    auto is_program_linked(const program_name prog) const noexcept -> bool {
+        return this->get_program_i(prog, this->link_status)
+          .transform([](auto status) { return bool(status); })
+          .value_or(false);
+    }
+
     /// @brief Compiles and attaches a shader to the specified program.
     /// @see build_program
     auto add_shader(
@@ -4212,6 +4453,71 @@ public:
         return add_shader(prog, shdr_type, shdr_res, {});
     }
 
+    /// @brief Specifies a SPIR-V module as the binary of a shader object.
+    /// @see add_spir_v_shader
+    auto shader_spir_v_binary(
+      const shader_name shdr,
+      const memory::const_block binary) const noexcept {
+        return this->shader_binary(
+          shdr, constants().shader_binary_format_spir_v, binary);
+    }
+
+    /// @brief Queries the type, location and array size of a program variable.
+    /// @see get_program_resource_iv
+    ///
+    /// All three properties are fetched with a single GL call.
+    auto get_program_variable_info(
+      const program_name prog,
+      const program_interface intf,
+      const uint_type index,
+      enum_type& type,
+      int_type& location,
+      int_type& array_size) const noexcept -> bool;
+
+    /// @brief Specializes and attaches a SPIR-V shader to the program.
+    /// @see add_shader
+    auto add_spir_v_shader(
+      const program_name prog,
+      shader_type shdr_type,
+      const spir_v_source_ref& shdr_src,
+      const string_view label) const noexcept -> c_api::
+      result<void, c_api::string_message_info, c_api::result_validity::maybe>;
+
+    /// @brief Specializes and attaches a SPIR-V shader to the program.
+    /// @see add_shader
+    auto add_spir_v_shader(
+      const program_name prog,
+      shader_type shdr_type,
+      const spir_v_source_ref& shdr_src) const noexcept {
+        return add_spir_v_shader(prog, shdr_type, shdr_src, {});
+    }
+
+    /// @brief Specializes and attaches a SPIR-V shader to the program.
+    /// @see add_shader
+    ///
+    /// The resource contains the binary SPIR-V module, the entry point
+    /// is main and no specialization constants are set.
+    auto add_spir_v_shader(
+      const program_name prog,
+      shader_type shdr_type,
+      const embedded_resource& shdr_res,
+      const string_view label) const noexcept {
+        return add_spir_v_shader(
+          prog,
+          shdr_type,
+          spir_v_source_ref{shdr_res.unpack(main_context())},
+          label);
+    }
+
+    /// @brief Specializes and attaches a SPIR-V shader to the program.
+    /// @see add_shader
+    auto add_spir_v_shader(
+      const program_name prog,
+      shader_type shdr_type,
+      const embedded_resource& shdr_res) const noexcept {
+        return add_spir_v_shader(prog, shdr_type, shdr_res, {});
+    }
+
 private:
     // set_uniform
     template <typename ProgramUniformFunc, typename UniformFunc, typename T>
@@ -4618,6 +4924,62 @@ auto basic_gl_api<ApiTraits>::add_shader(
 }
 //------------------------------------------------------------------------------
 template <typename ApiTraits>
+auto basic_gl_api<ApiTraits>::get_program_variable_info(
+  const program_name prog,
+  const program_interface intf,
+  const uint_type index,
+  enum_type& type,
+  int_type& location,
+  int_type& array_size) const noexcept -> bool {
+    const auto& GL{constants()};
+    const std::array<enum_type, 3> props{
+      {enum_type(program_property{GL.type}),
+       enum_type(program_property{GL.location}),
+       enum_type(program_property{GL.array_size})}};
+    std::array<int_type, 3> values{{0, -1, 0}};
+    if(not this->get_program_resource_iv(
+         prog, intf, index, view(props), cover(values))) {
+        return false;
+    }
+    type = static_cast<enum_type>(values[0]);
+    location = values[1];
+    array_size = values[2];
+    return true;
+}
+//------------------------------------------------------------------------------
+template <typename ApiTraits>
+auto basic_gl_api<ApiTraits>::add_spir_v_shader(
+  const program_name prog,
+  shader_type shdr_type,
+  const spir_v_source_ref& shdr_src,
+  const string_view label) const noexcept -> c_api::
+  result<void, c_api::string_message_info, c_api::result_validity::maybe> {
+    owned_shader_name shdr;
+    this->create_shader(shdr_type) >> shdr;
+    const auto cleanup{this->delete_shader.raii(shdr)};
+    if(not label.empty()) {
+        this->object_label(shdr, label);
+    }
+    std::string info_log;
+    bool success{true};
+    // the GLSL front-end is skipped, the module is only specialized
+    const std::string entry_point{to_string(shdr_src.entry_point())};
+    success = this->shader_spir_v_binary(shdr, shdr_src.binary()) and success;
+    success = this->specialize_shader(
+                shdr,
+                string_view{entry_point},
+                shdr_src.constant_indices(),
+                shdr_src.constant_values()) and
+              success;
+    success = this->is_shader_compiled(shdr) and success;
+    if(not success) {
+        shader_info_log(shdr).and_then(_1.assign_to(info_log));
+    }
+    success = this->attach_shader(prog, shdr) and success;
+    return {success, c_api::string_message_info{std::move(info_log)}};
+}
+//------------------------------------------------------------------------------
+template <typename ApiTraits>
 template <typename ProgramUniformFunc, typename UniformFunc, typename T>
 auto basic_gl_api<ApiTraits>::_set_uniform(
   ProgramUniformFunc& program_uniform_func,
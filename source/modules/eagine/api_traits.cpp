@@ -24,13 +24,47 @@ import eagine.core.memory;
 import eagine.core.c_api;
 import :config;
 import :result;
+import :function_names;
 
 namespace eagine::oglplus {
 //------------------------------------------------------------------------------
+/// @brief Counters of the GL functions linked by gl_api_traits.
+/// @ingroup gl_api_wrap
+export struct gl_link_stats {
+    /// @brief The number of functions for which linking was attempted.
+    span_size_t linked{0};
+    /// @brief The number of functions that were successfully resolved.
+    span_size_t resolved{0};
+    /// @brief The number of functions not found in gl_function_names.
+    span_size_t table_misses{0};
+};
+//------------------------------------------------------------------------------
+/// @brief Enumeration of the ways gl_api_traits resolves the GL functions.
+/// @ingroup gl_api_wrap
+export enum class gl_link_mode : std::uint8_t {
+    /// @brief All functions in gl_function_names are resolved in one pass.
+    /// @note The pass is done once per process, the results are shared.
+    batched,
+    /// @brief Each function is resolved separately when it is linked.
+    per_function
+};
+//------------------------------------------------------------------------------
+/// @brief Function returning the address of the named GL function (without gl).
+/// @ingroup gl_api_wrap
+/// @see gl_api_traits
+export using gl_function_resolver = auto (*)(const string_view name) -> void*;
+//------------------------------------------------------------------------------
 /// @brief Policy customizing the generic C-API wrappers for the GL API
 /// @ingroup gl_api_wrap
 export class gl_api_traits : public c_api::default_traits {
 public:
+    /// @brief Default constructor.
+    gl_api_traits() noexcept = default;
+
+    /// @brief Construction with the specified error checking policy.
+    explicit gl_api_traits(const gl_error_check_policy policy) noexcept
+      : _error_policy{policy} {}
+
     /// @brief Alias for result type of currently unavailable functions.
     template <typename R>
     using no_result = gl_no_result<R>;
@@ -58,28 +92,165 @@ public:
       string_view name,
       std::type_identity<Signature>) -> std::add_pointer_t<Signature>;
 
+    /// @brief Returns the counters of linked and resolved GL functions.
+    auto link_stats() const noexcept -> const gl_link_stats& {
+        return _link_stats;
+    }
+
+    /// @brief Returns the current GL error checking policy.
+    auto error_policy() const noexcept -> gl_error_check_policy {
+        return _error_policy;
+    }
+
+    /// @brief Returns the current function linking mode.
+    auto link_mode() const noexcept -> gl_link_mode {
+        return _link_mode;
+    }
+
+    /// @brief Changes the function linking mode.
+    auto set_link_mode(const gl_link_mode mode) noexcept -> gl_api_traits& {
+        _link_mode = mode;
+        return *this;
+    }
+
+    /// @brief Changes the GL error checking policy.
+    auto set_error_policy(const gl_error_check_policy policy) noexcept
+      -> gl_api_traits& {
+        _error_policy = policy;
+        return *this;
+    }
+
+    /// @brief Notes a wrapped call, returns if GetError should be called now.
+    auto begin_error_check() noexcept -> bool;
+
+    /// @brief Notes an invocation of GetError.
+    void note_get_error() noexcept {
+        ++_error_stats.get_error_calls;
+    }
+
+    /// @brief Starts collection of deferred errors for the recent calls.
+    auto begin_error_flush() noexcept -> gl_deferred_errors;
+
+    /// @brief Returns the error checking counters.
+    auto error_stats() const noexcept -> const gl_error_check_stats& {
+        return _error_stats;
+    }
+
+    /// @brief Resets the error checking counters (for example at frame start).
+    void reset_error_stats() noexcept {
+        _error_stats = {};
+    }
+
+protected:
+    /// @brief Construction with a custom resolver used instead of the GL one.
+    /// @see recording_gl_api_traits
+    explicit gl_api_traits(const gl_function_resolver resolver) noexcept
+      : _resolver{resolver} {}
+
 private:
+    static auto _batched_addresses() noexcept
+      -> const std::array<void*, gl_function_names.size()>&;
+    auto _lookup(string_view name) -> void*;
+    auto _get_proc_address(string_view name) -> void*;
+
     std::string _full_name;
+    gl_function_resolver _resolver{nullptr};
+    gl_link_stats _link_stats{};
+    gl_error_check_stats _error_stats{};
+    span_size_t _call_index{0};
+    span_size_t _flushed_index{0};
+    gl_error_check_policy _error_policy{gl_error_check_policy::immediate};
+    gl_link_mode _link_mode{gl_link_mode::batched};
 };
 //------------------------------------------------------------------------------
-template <typename Api, typename Tag, typename Signature>
-inline auto gl_api_traits::link_function(
-  Api&,
-  Tag,
-  string_view name,
-  std::type_identity<Signature>) -> std::add_pointer_t<Signature> {
+inline auto gl_api_traits::begin_error_check() noexcept -> bool {
+    ++_call_index;
+    ++_error_stats.checked_calls;
+    switch(_error_policy) {
+        case gl_error_check_policy::immediate:
+            return true;
+        case gl_error_check_policy::deferred:
+            return false;
+        case gl_error_check_policy::disabled_in_release:
+#ifdef NDEBUG
+            return false;
+#else
+            return true;
+#endif
+    }
+    return true;
+}
+//------------------------------------------------------------------------------
+inline auto gl_api_traits::begin_error_flush() noexcept -> gl_deferred_errors {
+    ++_error_stats.flushes;
+    const gl_deferred_errors result{_flushed_index, _call_index};
+    _flushed_index = _call_index;
+    return result;
+}
+//------------------------------------------------------------------------------
+inline auto gl_api_traits::_batched_addresses() noexcept
+  -> const std::array<void*, gl_function_names.size()>& {
+    // the GLX entry points do not depend on the current context,
+    // so they can be looked up only once and shared by all instances
+    static const auto addresses{[] {
+        std::array<void*, gl_function_names.size()> result{};
+#if EAGINE_HAS_GL
+        for(std::size_t i = 0; i < result.size(); ++i) {
+            result[i] = glXGetProcAddress(
+              reinterpret_cast<const gl_types::ubyte_type*>(
+                gl_function_names[i].data()));
+        }
+#endif
+        return result;
+    }()};
+    return addresses;
+}
+//------------------------------------------------------------------------------
+inline auto gl_api_traits::_lookup(string_view name) -> void* {
+    if(_link_mode == gl_link_mode::batched) {
+        if(const auto index{find_gl_function_name(
+             {name.data(), std::size_t(name.size())})}) {
+            return _batched_addresses()[*index];
+        }
+        ++_link_stats.table_misses;
+    }
+    return _get_proc_address(name);
+}
+//------------------------------------------------------------------------------
+inline auto gl_api_traits::_get_proc_address(
+  [[maybe_unused]] string_view name) -> void* {
     _full_name.clear();
     _full_name.reserve(2 + name.size() + 1);
     _full_name.append("gl");
     _full_name.append(name.data(), std::size_t(name.size()));
 #if EAGINE_HAS_GL
-    auto func = glXGetProcAddress(
+    return glXGetProcAddress(
       reinterpret_cast<const gl_types::ubyte_type*>(_full_name.c_str()));
-    // TODO: support for extension also needs to be checked
-    if(func != nullptr) {
+#else
+    return nullptr;
+#endif
+}
+//------------------------------------------------------------------------------
+template <typename Api, typename Tag, typename Signature>
+inline auto gl_api_traits::link_function(
+  Api&,
+  Tag,
+  string_view name,
+  std::type_identity<Signature>) -> std::add_pointer_t<Signature> {
+    ++_link_stats.linked;
+    if(_resolver) [[unlikely]] {
+        if(auto func{_resolver(name)}) {
+            ++_link_stats.resolved;
+            return reinterpret_cast<std::remove_pointer_t<Signature>*>(func);
+        }
+        return nullptr;
+    }
+    // extension functions are resolved like the core ones, the availability
+    // of the extensions is checked by basic_gl_operations::has_extension
+    if(auto func{_lookup(name)}) {
+        ++_link_stats.resolved;
         return reinterpret_cast<std::remove_pointer_t<Signature>*>(func);
     }
-#endif
     return nullptr;
 }
 //------------------------------------------------------------------------------
@@ -0,0 +1,181 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+
+#include <eagine/testing/unit_begin_ctx.hpp>
+import std;
+import eagine.core;
+import eagine.oglplus;
+//------------------------------------------------------------------------------
+namespace {
+//------------------------------------------------------------------------------
+void draw_frame(const eagine::oglplus::gl_api& glapi, std::size_t calls) {
+    const auto& [gl, GL] = glapi;
+    for(std::size_t i = 0; i < calls; i += 4) {
+        gl.enable(GL.depth_test);
+        gl.viewport(800, 600);
+        gl.clear(GL.color_buffer_bit | GL.depth_buffer_bit);
+        gl.disable(GL.depth_test);
+    }
+}
+//------------------------------------------------------------------------------
+auto get_error_calls_per_frame(
+  eagine::main_ctx_parent ctx,
+  eagine::oglplus::gl_error_check_policy policy,
+  std::size_t calls,
+  std::size_t frames) -> std::size_t {
+    using namespace eagine::oglplus;
+    gl_command_recorder recorder;
+    recording_gl_api_traits traits{recorder};
+    traits.set_error_policy(policy);
+    const gl_api glapi{ctx, traits};
+    recorder.clear();
+    for(std::size_t f = 0; f < frames; ++f) {
+        draw_frame(glapi, calls);
+        glapi.flush_errors();
+    }
+    return std::size_t(recorder.call_count("GetError")) / frames;
+}
+//------------------------------------------------------------------------------
+} // namespace
+//------------------------------------------------------------------------------
+void api_traits_get_error_per_frame(auto& s) {
+    eagitest::case_ test{s, 1, "GetError calls per frame"};
+    using eagine::oglplus::gl_error_check_policy;
+
+    const std::size_t calls{1024U};
+    const std::size_t frames{64U};
+
+    const auto immediate{get_error_calls_per_frame(
+      s.context(), gl_error_check_policy::immediate, calls, frames)};
+    const auto deferred{get_error_calls_per_frame(
+      s.context(), gl_error_check_policy::deferred, calls, frames)};
+    const auto release{get_error_calls_per_frame(
+      s.context(), gl_error_check_policy::disabled_in_release, calls, frames)};
+
+    s.context()
+      .log()
+      .info("GetError calls per frame")
+      .arg("calls", calls)
+      .arg("immediate", immediate)
+      .arg("deferred", deferred)
+      .arg("release", release);
+
+    test.check_equal(immediate, calls + 1U, "immediate");
+    test.check_equal(deferred, 1U, "deferred");
+#ifdef NDEBUG
+    test.check_equal(release, 1U, "disabled in release");
+#else
+    test.check_equal(release, calls + 1U, "disabled in release");
+#endif
+}
+//------------------------------------------------------------------------------
+void api_traits_deferred_call_range(auto& s) {
+    eagitest::case_ test{s, 2, "deferred error call range"};
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    recording_gl_api_traits traits{recorder};
+    traits.set_error_policy(gl_error_check_policy::deferred);
+    const gl_api glapi{s.context(), traits};
+
+    draw_frame(glapi, 16U);
+    const auto first{glapi.flush_errors()};
+    test.check(bool(first), "no errors 1");
+    test.check_equal(first.first_call(), 0, "first 1");
+    test.check_equal(first.end_call(), 16, "end 1");
+
+    draw_frame(glapi, 8U);
+    const auto second{glapi.flush_errors()};
+    test.check(bool(second), "no errors 2");
+    test.check_equal(second.first_call(), 16, "first 2");
+    test.check_equal(second.end_call(), 24, "end 2");
+
+    const auto& stats{glapi.error_check_stats()};
+    test.check_equal(stats.checked_calls, 24, "checked calls");
+    test.check_equal(stats.flushes, 2, "flushes");
+}
+//------------------------------------------------------------------------------
+template <typename... Traits>
+auto gl_api_construction_time(
+  eagine::main_ctx_parent ctx,
+  std::size_t repeats,
+  eagine::oglplus::gl_link_stats& stats,
+  Traits&... traits) -> std::chrono::duration<float, std::micro> {
+    const auto start{std::chrono::steady_clock::now()};
+    for(std::size_t r = 0; r < repeats; ++r) {
+        const eagine::oglplus::gl_api glapi{ctx, traits...};
+        stats = glapi.operations().traits().link_stats();
+    }
+    return std::chrono::steady_clock::now() - start;
+}
+//------------------------------------------------------------------------------
+void api_traits_construction_time(auto& s) {
+    eagitest::case_ test{s, 3, "gl_api construction time"};
+    using namespace eagine::oglplus;
+
+    // the recording traits link the same functions without looking up
+    // the GL entry points, which leaves the cost of the wrapper itself
+    gl_command_recorder recorder;
+    recording_gl_api_traits recording{recorder};
+    gl_api_traits per_function;
+    per_function.set_link_mode(gl_link_mode::per_function);
+    gl_api_traits batched;
+    batched.set_link_mode(gl_link_mode::batched);
+    gl_link_stats recorded{};
+    gl_link_stats separate{};
+    gl_link_stats first{};
+    gl_link_stats shared{};
+
+    const std::size_t repeats{16U};
+    const auto without_lookup{
+      gl_api_construction_time(s.context(), repeats, recorded, recording)};
+    const auto with_lookup{gl_api_construction_time(
+      s.context(), repeats, separate, per_function)};
+    // the first batched instance resolves the whole table, the others
+    // only find the names in it and reuse the shared addresses
+    const auto first_batch{
+      gl_api_construction_time(s.context(), 1U, first, batched)};
+    const auto with_batch{
+      gl_api_construction_time(s.context(), repeats, shared, batched)};
+
+    const auto per_call{[&](auto elapsed) {
+        return elapsed.count() / float(repeats);
+    }};
+    s.context()
+      .log()
+      .info("gl_api construction time")
+      .arg("repeats", repeats)
+      .arg("linked", separate.linked)
+      .arg("resolved", separate.resolved)
+      .arg("tableMisses", shared.table_misses)
+      .arg("perFunction", per_call(with_lookup))
+      .arg("firstBatch", first_batch.count())
+      .arg("batched", per_call(with_batch))
+      .arg("noLookup", per_call(without_lookup))
+      .arg("lookup", per_call(with_lookup - without_lookup))
+      .arg("gain", per_call(with_lookup - with_batch));
+
+    test.check_equal(recorded.linked, separate.linked, "same functions");
+    test.check_equal(recorded.resolved, recorded.linked, "all recorded");
+    test.check(separate.resolved <= separate.linked, "resolved <= linked");
+    test.check_equal(shared.linked, separate.linked, "same linked");
+    test.check_equal(shared.resolved, separate.resolved, "same resolved");
+    test.check_equal(first.resolved, shared.resolved, "first resolved");
+    test.check_equal(shared.table_misses, 0, "no table misses");
+    test.check_equal(separate.table_misses, 0, "no misses per function");
+}
+//------------------------------------------------------------------------------
+auto test_main(eagine::test_ctx& ctx) -> int {
+    eagitest::ctx_suite test{ctx, "api_traits", 3};
+    test.once(api_traits_get_error_per_frame);
+    test.once(api_traits_deferred_call_range);
+    test.once(api_traits_construction_time);
+    return test.exit_code();
+}
+//------------------------------------------------------------------------------
+#include <eagine/testing/unit_end_ctx.hpp>
@@ -0,0 +1,123 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.oglplus:buffer_ring;
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import :config;
+import :enum_types;
+import :objects;
+import :api;
+
+namespace eagine::oglplus {
+//------------------------------------------------------------------------------
+/// @brief Persistently mapped buffer split into segments guarded by fences.
+/// @ingroup gl_utils
+/// @see pixel_unpack_ring
+/// @see uniform_buffer_ring
+///
+/// A segment is written through the mapped memory after it is acquired and
+/// is released after the GL commands reading from it are issued. Each
+/// released segment is guarded by a fence, which is waited on only when
+/// the ring wraps around to the segment again. The ring requires
+/// buffer_storage and map_buffer_range (or their DSA variants); if they
+/// are not available init fails.
+export class mapped_buffer_ring {
+public:
+    /// @brief Construction with the specified segment byte size and count.
+    mapped_buffer_ring(
+      const span_size_t segment_size,
+      const span_size_t segment_count) noexcept
+      : _segment_size{segment_size}
+      , _fences(std_size(segment_count), nullptr) {}
+
+    mapped_buffer_ring(mapped_buffer_ring&&) noexcept = default;
+    mapped_buffer_ring(const mapped_buffer_ring&) = delete;
+    auto operator=(mapped_buffer_ring&&) noexcept
+      -> mapped_buffer_ring& = default;
+    auto operator=(const mapped_buffer_ring&) = delete;
+    ~mapped_buffer_ring() noexcept = default;
+
+    /// @brief Rounds the segment size up to a multiple of the alignment.
+    /// @pre not is_initialized()
+    void align_segments(const span_size_t alignment) noexcept {
+        if(alignment > 0) {
+            _segment_size =
+              ((_segment_size + alignment - 1) / alignment) * alignment;
+        }
+    }
+
+    /// @brief Creates and persistently maps the buffer storage.
+    auto init(const gl_api& glapi) -> bool;
+
+    /// @brief Indicates if the ring buffer is created and mapped.
+    auto is_initialized() const noexcept -> bool {
+        return _mapped != nullptr;
+    }
+
+    /// @brief Indicates if the ring buffer is created and mapped.
+    /// @see is_initialized
+    explicit operator bool() const noexcept {
+        return is_initialized();
+    }
+
+    /// @brief Returns the byte size of a single segment.
+    auto segment_size() const noexcept -> span_size_t {
+        return _segment_size;
+    }
+
+    /// @brief Returns the number of segments.
+    auto segment_count() const noexcept -> span_size_t {
+        return span_size(_fences.size());
+    }
+
+    /// @brief Returns the name of the buffer.
+    auto buffer() const noexcept -> buffer_name {
+        return _buffer;
+    }
+
+    /// @brief Returns the index of the next segment.
+    /// @see release
+    ///
+    /// Waits for the GPU to finish reading from the segment if necessary.
+    /// Returns a negative value if the ring has no segments.
+    auto acquire(const gl_api& glapi) noexcept -> span_size_t;
+
+    /// @brief Returns the mapped memory of the specified segment.
+    auto segment(const span_size_t index) const noexcept -> memory::block {
+        return {_mapped + segment_offset(index), _segment_size};
+    }
+
+    /// @brief Returns the offset of the specified segment in the buffer.
+    auto segment_offset(const span_size_t index) const noexcept
+      -> span_size_t {
+        return index * _segment_size;
+    }
+
+    /// @brief Marks the end of GL commands reading the specified segment.
+    /// @see acquire
+    void release(const gl_api& glapi, const span_size_t index) noexcept;
+
+    /// @brief Returns how many times acquire had to wait for the GPU.
+    auto stall_count() const noexcept -> span_size_t {
+        return _stall_count;
+    }
+
+    /// @brief Unmaps and deletes the buffer and the pending fences.
+    void clean_up(const gl_api& glapi);
+
+private:
+    span_size_t _segment_size;
+    std::vector<gl_types::sync_type> _fences;
+    owned_buffer_name _buffer;
+    byte* _mapped{nullptr};
+    span_size_t _next{0};
+    span_size_t _stall_count{0};
+};
+//------------------------------------------------------------------------------
+} // namespace eagine::oglplus
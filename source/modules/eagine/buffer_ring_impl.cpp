@@ -0,0 +1,136 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+
+module eagine.oglplus;
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+
+namespace eagine::oglplus {
+//------------------------------------------------------------------------------
+// mapped_buffer_ring
+//------------------------------------------------------------------------------
+auto mapped_buffer_ring::init(const gl_api& glapi) -> bool {
+    const auto& [gl, GL] = glapi;
+    const auto size{_segment_size * segment_count()};
+    if(size <= 0) {
+        return false;
+    }
+    const auto storage_flags{
+      buffer_storage_bit(GL.map_write_bit) |
+      buffer_storage_bit(GL.map_persistent_bit) |
+      buffer_storage_bit(GL.map_coherent_bit)};
+    const auto access_flags{
+      buffer_map_access_bit(GL.map_write_bit) |
+      buffer_map_access_bit(GL.map_persistent_bit) |
+      buffer_map_access_bit(GL.map_coherent_bit)};
+
+    void* mapped{nullptr};
+    if(
+      gl.create_buffers and gl.named_buffer_storage and
+      gl.map_named_buffer_range) {
+        // the DSA functions need a buffer object that already exists
+        gl.create_buffers() >> _buffer;
+        gl.named_buffer_storage(
+          _buffer,
+          limit_cast<gl_types::sizeiptr_type>(size),
+          nullptr,
+          storage_flags);
+        mapped = gl.map_named_buffer_range(
+                     _buffer,
+                     0,
+                     limit_cast<gl_types::sizeiptr_type>(size),
+                     access_flags)
+                   .value_or(nullptr);
+    } else if(gl.buffer_storage and gl.map_buffer_range) {
+        // buffers are not tied to a target, the copy write target
+        // does not disturb the bindings used by the rendering code
+        gl.gen_buffers() >> _buffer;
+        gl.bind_buffer(GL.copy_write_buffer, _buffer);
+        gl.buffer_storage(
+          GL.copy_write_buffer,
+          limit_cast<gl_types::sizeiptr_type>(size),
+          nullptr,
+          storage_flags);
+        mapped = gl.map_buffer_range(
+                     GL.copy_write_buffer,
+                     0,
+                     limit_cast<gl_types::sizeiptr_type>(size),
+                     access_flags)
+                   .value_or(nullptr);
+        gl.bind_buffer(GL.copy_write_buffer, no_buffer);
+    }
+    _mapped = static_cast<byte*>(mapped);
+    if(not _mapped and _buffer) {
+        glapi.clean_up(std::move(_buffer));
+    }
+    return is_initialized();
+}
+//------------------------------------------------------------------------------
+auto mapped_buffer_ring::acquire(const gl_api& glapi) noexcept
+  -> span_size_t {
+    if(_fences.empty()) {
+        return -1;
+    }
+    const auto index{_next};
+    _next = (_next + 1) % segment_count();
+    auto& fence{_fences[std_size(index)]};
+    if(fence) {
+        const auto& [gl, GL] = glapi;
+        const auto wait{[&](auto... timeout) {
+            return gl.client_wait_sync(fence, timeout...)
+                     .value_or(GL.already_signaled) == GL.timeout_expired;
+        }};
+        if(wait()) {
+            // the GPU has not finished reading from the segment yet
+            ++_stall_count;
+            gl.flush();
+            while(wait(std::chrono::milliseconds{1})) {
+            }
+        }
+        gl.delete_sync(fence);
+        fence = nullptr;
+    }
+    return index;
+}
+//------------------------------------------------------------------------------
+void mapped_buffer_ring::release(
+  const gl_api& glapi,
+  const span_size_t index) noexcept {
+    if((index < 0) or (index >= segment_count())) {
+        return;
+    }
+    auto& fence{_fences[std_size(index)]};
+    if(fence) {
+        glapi.delete_sync(fence);
+    }
+    fence = glapi.fence_sync().value_or(nullptr);
+}
+//------------------------------------------------------------------------------
+void mapped_buffer_ring::clean_up(const gl_api& glapi) {
+    for(auto& fence : _fences) {
+        if(fence) {
+            glapi.delete_sync(fence);
+            fence = nullptr;
+        }
+    }
+    if(_buffer) {
+        const auto& [gl, GL] = glapi;
+        if(gl.unmap_named_buffer) {
+            gl.unmap_named_buffer(_buffer);
+        } else {
+            gl.bind_buffer(GL.copy_write_buffer, _buffer);
+            gl.unmap_buffer(GL.copy_write_buffer);
+            gl.bind_buffer(GL.copy_write_buffer, no_buffer);
+        }
+        glapi.clean_up(std::move(_buffer));
+    }
+    _mapped = nullptr;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::oglplus
@@ -109,10 +109,38 @@ public:
 
     template <typename Result, typename... U>
     constexpr auto check_result(Result res, U&&...) const noexcept {
-        res.error_code(this->GetError());
+        if(_traits.begin_error_check()) {
+            _traits.note_get_error();
+            res.error_code(this->GetError());
+        }
         return res;
     }
 
+    /// @brief Collects the GL errors generated since the previous flush.
+    /// @see gl_error_check_policy
+    /// @see error_check_stats
+    ///
+    /// With the deferred error checking policy this should be called at
+    /// checkpoints, for example at the end of each frame. The returned
+    /// object holds the error codes and the range of the wrapped calls
+    /// which could have generated them.
+    auto flush_errors() const noexcept -> gl_deferred_errors;
+
+    /// @brief Returns the counters of the GL error checking overhead.
+    auto error_check_stats() const noexcept -> const gl_error_check_stats& {
+        return _traits.error_stats();
+    }
+
+    /// @brief Resets the counters of the GL error checking overhead.
+    void reset_error_check_stats() const noexcept {
+        _traits.reset_error_stats();
+    }
+
+    /// @brief Changes the GL error checking policy.
+    void set_error_check_policy(gl_error_check_policy policy) const noexcept {
+        _traits.set_error_policy(policy);
+    }
+
     /// @var GetError
     /// @glfuncwrap{GetError}
     gl_api_function<enum_type(), OGLPLUS_GL_STATIC_FUNC(GetError)> GetError{
@@ -2559,6 +2587,13 @@ public:
       OGLPLUS_GL_STATIC_FUNC(ProgramBinary)>
       ProgramBinary{"ProgramBinary", *this};
 
+    /// @var ProgramParameteri
+    /// @glfuncwrap{ProgramParameteri}
+    gl_api_function<
+      void(uint_type, enum_type, int_type),
+      OGLPLUS_GL_STATIC_FUNC(ProgramParameteri)>
+      ProgramParameteri{"ProgramParameteri", *this};
+
     /// @var GetProgramBinary
     /// @glfuncwrap{GetProgramBinary}
     gl_api_function<
@@ -5866,6 +5901,27 @@ public:
     auto traits() noexcept -> api_traits& {
         return _traits;
     }
+
+    auto traits() const noexcept -> const api_traits& {
+        return _traits;
+    }
 };
 //------------------------------------------------------------------------------
+template <typename ApiTraits>
+auto basic_gl_c_api<ApiTraits>::flush_errors() const noexcept
+  -> gl_deferred_errors {
+    auto result{_traits.begin_error_flush()};
+    if(GetError) {
+        while(result.can_add()) {
+            _traits.note_get_error();
+            const auto ec{GetError()};
+            if(gl_types::error_code_no_error(ec)) {
+                break;
+            }
+            result.add(ec);
+        }
+    }
+    return result;
+}
+//------------------------------------------------------------------------------
 } // namespace eagine::oglplus
@@ -1206,6 +1206,20 @@ public:
       true_false>
       compile_status;
 
+    /// @var completion_status
+    /// @glconstwrap{COMPLETION_STATUS}
+    opt_constant<
+      mp_list<shader_parameter, program_parameter>,
+#ifdef GL_COMPLETION_STATUS_KHR
+      enum_type_c<GL_COMPLETION_STATUS_KHR>,
+#elif defined(GL_COMPLETION_STATUS_ARB)
+      enum_type_c<GL_COMPLETION_STATUS_ARB>,
+#else
+      enum_type_i,
+#endif
+      true_false>
+      completion_status;
+
     /// @var info_log_length
     /// @glconstwrap{INFO_LOG_LENGTH}
     opt_constant<
@@ -1365,6 +1379,18 @@ public:
 #endif
       program_binary_length;
 
+    /// @var program_binary_retrievable_hint
+    /// @glconstwrap{PROGRAM_BINARY_RETRIEVABLE_HINT}
+    opt_constant<
+      mp_list<program_parameter>,
+#ifdef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+      enum_type_c<GL_PROGRAM_BINARY_RETRIEVABLE_HINT>,
+#else
+      enum_type_i,
+#endif
+      true_false>
+      program_binary_retrievable_hint;
+
     /// @var compute_work_group_size
     /// @glconstwrap{COMPUTE_WORK_GROUP_SIZE}
     opt_constant<
@@ -1464,6 +1490,17 @@ public:
 #endif
       program_binary_format_mesa;
 
+    /// @var shader_binary_format_spir_v
+    /// @glconstwrap{SHADER_BINARY_FORMAT_SPIR_V}
+    opt_constant<
+      mp_list<shader_binary_format>,
+#ifdef GL_SHADER_BINARY_FORMAT_SPIR_V
+      enum_type_c<GL_SHADER_BINARY_FORMAT_SPIR_V>>
+#else
+      enum_type_i>
+#endif
+      shader_binary_format_spir_v;
+
     /// @var active_program
     /// @glconstwrap{ACTIVE_PROGRAM}
     opt_constant<
@@ -4065,6 +4102,28 @@ public:
 #endif
       fragment_input_nv;
 
+    /// @var active_resources
+    /// @glconstwrap{ACTIVE_RESOURCES}
+    opt_constant<
+      mp_list<program_property>,
+#ifdef GL_ACTIVE_RESOURCES
+      enum_type_c<GL_ACTIVE_RESOURCES>>
+#else
+      enum_type_i>
+#endif
+      active_resources;
+
+    /// @var max_name_length
+    /// @glconstwrap{MAX_NAME_LENGTH}
+    opt_constant<
+      mp_list<program_property>,
+#ifdef GL_MAX_NAME_LENGTH
+      enum_type_c<GL_MAX_NAME_LENGTH>>
+#else
+      enum_type_i>
+#endif
+      max_name_length;
+
     /// @var active_variables
     /// @glconstwrap{ACTIVE_VARIABLES}
     opt_constant<
@@ -5760,6 +5819,17 @@ public:
 #endif
       texture_buffer_offset_alignment;
 
+    /// @var uniform_buffer_offset_alignment
+    /// @glconstwrap{UNIFORM_BUFFER_OFFSET_ALIGNMENT}
+    opt_constant<
+      mp_list<integer_query>,
+#ifdef GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+      enum_type_c<GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT>>
+#else
+      enum_type_i>
+#endif
+      uniform_buffer_offset_alignment;
+
     /// @var max_vertex_uniform_blocks
     /// @glconstwrap{MAX_VERTEX_UNIFORM_BLOCKS}
     opt_constant<
@@ -13119,6 +13189,7 @@ basic_gl_constants<ApiTraits>::basic_gl_constants(
   , active_subroutine_max_length("ACTIVE_SUBROUTINE_MAX_LENGTH", traits, api)
   , delete_status("DELETE_STATUS", traits, api)
   , compile_status("COMPILE_STATUS", traits, api)
+  , completion_status("COMPLETION_STATUS", traits, api)
   , info_log_length("INFO_LOG_LENGTH", traits, api)
   , shader_source_length("SHADER_SOURCE_LENGTH", traits, api)
   , spir_v_binary("SPIR_V_BINARY", traits, api)
@@ -13133,6 +13204,10 @@ basic_gl_constants<ApiTraits>::basic_gl_constants(
   , active_uniforms("ACTIVE_UNIFORMS", traits, api)
   , active_uniform_max_length("ACTIVE_UNIFORM_MAX_LENGTH", traits, api)
   , program_binary_length("PROGRAM_BINARY_LENGTH", traits, api)
+  , program_binary_retrievable_hint(
+      "PROGRAM_BINARY_RETRIEVABLE_HINT",
+      traits,
+      api)
   , compute_work_group_size("COMPUTE_WORK_GROUP_SIZE", traits, api)
   , transform_feedback_buffer_mode("TRANSFORM_FEEDBACK_BUFFER_MODE", traits, api)
   , transform_feedback_varyings("TRANSFORM_FEEDBACK_VARYINGS", traits, api)
@@ -13145,6 +13220,7 @@ basic_gl_constants<ApiTraits>::basic_gl_constants(
   , geometry_output_type("GEOMETRY_OUTPUT_TYPE", traits, api)
   , tess_gen_point_mode("TESS_GEN_POINT_MODE", traits, api)
   , program_binary_format_mesa("PROGRAM_BINARY_FORMAT_MESA", traits, api)
+  , shader_binary_format_spir_v("SHADER_BINARY_FORMAT_SPIR_V", traits, api)
   , active_program("ACTIVE_PROGRAM", traits, api)
   , renderbuffer_width("RENDERBUFFER_WIDTH", traits, api)
   , renderbuffer_height("RENDERBUFFER_HEIGHT", traits, api)
@@ -13465,6 +13541,8 @@ basic_gl_constants<ApiTraits>::basic_gl_constants(
   , buffer_variable("BUFFER_VARIABLE", traits, api)
   , buffer_storage_block("BUFFER_STORAGE_BLOCK", traits, api)
   , fragment_input_nv("FRAGMENT_INPUT_NV", traits, api)
+  , active_resources("ACTIVE_RESOURCES", traits, api)
+  , max_name_length("MAX_NAME_LENGTH", traits, api)
   , active_variables("ACTIVE_VARIABLES", traits, api)
   , num_active_variables("NUM_ACTIVE_VARIABLES", traits, api)
   , array_size("ARRAY_SIZE", traits, api)
@@ -13642,6 +13720,10 @@ basic_gl_constants<ApiTraits>::basic_gl_constants(
       "TEXTURE_BUFFER_OFFSET_ALIGNMENT",
       traits,
       api)
+  , uniform_buffer_offset_alignment(
+      "UNIFORM_BUFFER_OFFSET_ALIGNMENT",
+      traits,
+      api)
   , max_vertex_uniform_blocks("MAX_VERTEX_UNIFORM_BLOCKS", traits, api)
   , max_tess_control_uniform_blocks(
       "MAX_TESS_CONTROL_UNIFORM_BLOCKS",
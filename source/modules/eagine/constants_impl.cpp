@@ -174,6 +174,60 @@ auto within_limits<oglplus::pixel_internal_format, oglplus::gl_types::enum_type>
         case GL_COMPRESSED_RGBA:
         case GL_COMPRESSED_SRGB:
         case GL_COMPRESSED_SRGB_ALPHA:
+#ifdef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+        case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+        case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+        case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+        case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+#endif
+        case GL_COMPRESSED_RED_RGTC1:
+        case GL_COMPRESSED_SIGNED_RED_RGTC1:
+        case GL_COMPRESSED_RG_RGTC2:
+        case GL_COMPRESSED_SIGNED_RG_RGTC2:
+        case GL_COMPRESSED_RGBA_BPTC_UNORM:
+        case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+        case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
+        case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
+        case GL_COMPRESSED_RGB8_ETC2:
+        case GL_COMPRESSED_SRGB8_ETC2:
+        case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+        case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+        case GL_COMPRESSED_RGBA8_ETC2_EAC:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
+        case GL_COMPRESSED_R11_EAC:
+        case GL_COMPRESSED_SIGNED_R11_EAC:
+        case GL_COMPRESSED_RG11_EAC:
+        case GL_COMPRESSED_SIGNED_RG11_EAC:
+#ifdef GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+        case GL_COMPRESSED_RGBA_ASTC_4x4_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_5x4_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_5x5_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_6x5_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_6x6_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_8x5_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_8x6_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_8x8_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_10x5_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_10x6_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_10x8_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_10x10_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_12x10_KHR:
+        case GL_COMPRESSED_RGBA_ASTC_12x12_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR:
+#endif
         case GL_R16F:
         case GL_R32F:
         case GL_R8:
@@ -339,6 +393,100 @@ auto map_gl_enum_by_name() noexcept {
       .add("compressed_rgba", GL_COMPRESSED_RGBA)
       .add("compressed_srgb", GL_COMPRESSED_SRGB)
       .add("compressed_srgb_alpha", GL_COMPRESSED_SRGB_ALPHA)
+#ifdef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+      .add("compressed_rgb_s3tc_dxt1", GL_COMPRESSED_RGB_S3TC_DXT1_EXT)
+      .add("compressed_rgba_s3tc_dxt1", GL_COMPRESSED_RGBA_S3TC_DXT1_EXT)
+      .add("compressed_rgba_s3tc_dxt3", GL_COMPRESSED_RGBA_S3TC_DXT3_EXT)
+      .add("compressed_rgba_s3tc_dxt5", GL_COMPRESSED_RGBA_S3TC_DXT5_EXT)
+#endif
+      .add("compressed_r11_eac", GL_COMPRESSED_R11_EAC)
+      .add("compressed_red_rgtc1", GL_COMPRESSED_RED_RGTC1)
+      .add("compressed_rg11_eac", GL_COMPRESSED_RG11_EAC)
+      .add("compressed_rg_rgtc2", GL_COMPRESSED_RG_RGTC2)
+      .add("compressed_rgb8_etc2", GL_COMPRESSED_RGB8_ETC2)
+      .add(
+        "compressed_rgb8_punchthrough_alpha1_etc2",
+        GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2)
+      .add(
+        "compressed_rgb_bptc_signed_float",
+        GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT)
+      .add(
+        "compressed_rgb_bptc_unsigned_float",
+        GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT)
+      .add("compressed_rgba8_etc2_eac", GL_COMPRESSED_RGBA8_ETC2_EAC)
+      .add("compressed_rgba_bptc_unorm", GL_COMPRESSED_RGBA_BPTC_UNORM)
+      .add("compressed_signed_r11_eac", GL_COMPRESSED_SIGNED_R11_EAC)
+      .add("compressed_signed_red_rgtc1", GL_COMPRESSED_SIGNED_RED_RGTC1)
+      .add("compressed_signed_rg11_eac", GL_COMPRESSED_SIGNED_RG11_EAC)
+      .add("compressed_signed_rg_rgtc2", GL_COMPRESSED_SIGNED_RG_RGTC2)
+      .add(
+        "compressed_srgb8_alpha8_etc2_eac",
+        GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC)
+      .add("compressed_srgb8_etc2", GL_COMPRESSED_SRGB8_ETC2)
+      .add(
+        "compressed_srgb8_punchthrough_alpha1_etc2",
+        GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2)
+      .add(
+        "compressed_srgb_alpha_bptc_unorm",
+        GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM)
+#ifdef GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+      .add("compressed_rgba_astc_10x10", GL_COMPRESSED_RGBA_ASTC_10x10_KHR)
+      .add("compressed_rgba_astc_10x5", GL_COMPRESSED_RGBA_ASTC_10x5_KHR)
+      .add("compressed_rgba_astc_10x6", GL_COMPRESSED_RGBA_ASTC_10x6_KHR)
+      .add("compressed_rgba_astc_10x8", GL_COMPRESSED_RGBA_ASTC_10x8_KHR)
+      .add("compressed_rgba_astc_12x10", GL_COMPRESSED_RGBA_ASTC_12x10_KHR)
+      .add("compressed_rgba_astc_12x12", GL_COMPRESSED_RGBA_ASTC_12x12_KHR)
+      .add("compressed_rgba_astc_4x4", GL_COMPRESSED_RGBA_ASTC_4x4_KHR)
+      .add("compressed_rgba_astc_5x4", GL_COMPRESSED_RGBA_ASTC_5x4_KHR)
+      .add("compressed_rgba_astc_5x5", GL_COMPRESSED_RGBA_ASTC_5x5_KHR)
+      .add("compressed_rgba_astc_6x5", GL_COMPRESSED_RGBA_ASTC_6x5_KHR)
+      .add("compressed_rgba_astc_6x6", GL_COMPRESSED_RGBA_ASTC_6x6_KHR)
+      .add("compressed_rgba_astc_8x5", GL_COMPRESSED_RGBA_ASTC_8x5_KHR)
+      .add("compressed_rgba_astc_8x6", GL_COMPRESSED_RGBA_ASTC_8x6_KHR)
+      .add("compressed_rgba_astc_8x8", GL_COMPRESSED_RGBA_ASTC_8x8_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_10x10",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_10x5",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_10x6",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_10x8",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_12x10",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_12x12",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_4x4",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_5x4",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_5x5",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_6x5",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_6x6",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_8x5",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_8x6",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR)
+      .add(
+        "compressed_srgb8_alpha8_astc_8x8",
+        GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR)
+#endif
       .add("compute_shader", GL_COMPUTE_SHADER)
       .add("copy_read_buffer", GL_COPY_READ_BUFFER)
       .add("copy_write_buffer", GL_COPY_WRITE_BUFFER)
@@ -472,5 +620,90 @@ auto gl_enum_by_name(const string_view name) noexcept
     return {};
 }
 //------------------------------------------------------------------------------
+auto compression_block_of(const pixel_internal_format iformat) noexcept
+  -> std::optional<texture_compression_block> {
+    [[maybe_unused]] const auto block{[](int w, int h, span_size_t size) {
+        return texture_compression_block{.width = w, .height = h, .size = size};
+    }};
+    switch(gl_types::enum_type(iformat)) {
+#if EAGINE_HAS_GL
+#ifdef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+        case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+        case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+            return block(4, 4, 8);
+        case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+        case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+            return block(4, 4, 16);
+#endif
+        case GL_COMPRESSED_RED_RGTC1:
+        case GL_COMPRESSED_SIGNED_RED_RGTC1:
+        case GL_COMPRESSED_RGB8_ETC2:
+        case GL_COMPRESSED_SRGB8_ETC2:
+        case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+        case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+        case GL_COMPRESSED_R11_EAC:
+        case GL_COMPRESSED_SIGNED_R11_EAC:
+            return block(4, 4, 8);
+        case GL_COMPRESSED_RG_RGTC2:
+        case GL_COMPRESSED_SIGNED_RG_RGTC2:
+        case GL_COMPRESSED_RGBA_BPTC_UNORM:
+        case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+        case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
+        case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
+        case GL_COMPRESSED_RGBA8_ETC2_EAC:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
+        case GL_COMPRESSED_RG11_EAC:
+        case GL_COMPRESSED_SIGNED_RG11_EAC:
+            return block(4, 4, 16);
+#ifdef GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+        case GL_COMPRESSED_RGBA_ASTC_4x4_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR:
+            return block(4, 4, 16);
+        case GL_COMPRESSED_RGBA_ASTC_5x4_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR:
+            return block(5, 4, 16);
+        case GL_COMPRESSED_RGBA_ASTC_5x5_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR:
+            return block(5, 5, 16);
+        case GL_COMPRESSED_RGBA_ASTC_6x5_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR:
+            return block(6, 5, 16);
+        case GL_COMPRESSED_RGBA_ASTC_6x6_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR:
+            return block(6, 6, 16);
+        case GL_COMPRESSED_RGBA_ASTC_8x5_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR:
+            return block(8, 5, 16);
+        case GL_COMPRESSED_RGBA_ASTC_8x6_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR:
+            return block(8, 6, 16);
+        case GL_COMPRESSED_RGBA_ASTC_8x8_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR:
+            return block(8, 8, 16);
+        case GL_COMPRESSED_RGBA_ASTC_10x5_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR:
+            return block(10, 5, 16);
+        case GL_COMPRESSED_RGBA_ASTC_10x6_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR:
+            return block(10, 6, 16);
+        case GL_COMPRESSED_RGBA_ASTC_10x8_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR:
+            return block(10, 8, 16);
+        case GL_COMPRESSED_RGBA_ASTC_10x10_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR:
+            return block(10, 10, 16);
+        case GL_COMPRESSED_RGBA_ASTC_12x10_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR:
+            return block(12, 10, 16);
+        case GL_COMPRESSED_RGBA_ASTC_12x12_KHR:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR:
+            return block(12, 12, 16);
+#endif
+#endif
+        default:
+            return {};
+    }
+}
+//------------------------------------------------------------------------------
 } // namespace oglplus
 } // namespace eagine
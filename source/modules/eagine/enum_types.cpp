@@ -255,6 +255,13 @@ export struct program_binary_format
     using enum_class::enum_class;
 };
 
+/// @brief Typed enumeration for GL shader binary format constants.
+/// @ingroup gl_api_wrap
+export struct shader_binary_format
+  : gl_enum_class<shader_binary_format, "ShdrBinFmt"> {
+    using enum_class::enum_class;
+};
+
 /// @brief Typed enumeration for GL program pipeline parameter constants.
 /// @ingroup gl_api_wrap
 export struct program_pipeline_parameter
@@ -6,6 +6,7 @@
 /// https://www.boost.org/LICENSE_1_0.txt
 ///
 export module eagine.oglplus:extensions;
+import std;
 import eagine.core.types;
 import eagine.core.memory;
 
@@ -13,7 +14,132 @@ namespace eagine::oglplus {
 
 export template <typename ApiTraits>
 class basic_gl_operations;
+//------------------------------------------------------------------------------
+/// @brief Names of the GL extensions with a cached availability flag.
+/// @ingroup gl_api_wrap
+/// @see gl_extension_table
+/// @note The names are without the GL_ prefix and must be kept sorted.
+export constexpr const std::array<string_view, 32> known_gl_extensions{
+  {string_view{"AMD_debug_output"},
+   string_view{"ARB_bindless_texture"},
+   string_view{"ARB_buffer_storage"},
+   string_view{"ARB_compatibility"},
+   string_view{"ARB_compute_shader"},
+   string_view{"ARB_debug_output"},
+   string_view{"ARB_direct_state_access"},
+   string_view{"ARB_draw_indirect"},
+   string_view{"ARB_get_program_binary"},
+   string_view{"ARB_gl_spirv"},
+   string_view{"ARB_indirect_parameters"},
+   string_view{"ARB_invalidate_subdata"},
+   string_view{"ARB_multi_bind"},
+   string_view{"ARB_multi_draw_indirect"},
+   string_view{"ARB_parallel_shader_compile"},
+   string_view{"ARB_program_interface_query"},
+   string_view{"ARB_robustness"},
+   string_view{"ARB_separate_shader_objects"},
+   string_view{"ARB_shader_draw_parameters"},
+   string_view{"ARB_shader_storage_buffer_object"},
+   string_view{"ARB_shading_language_include"},
+   string_view{"ARB_sparse_texture"},
+   string_view{"ARB_texture_compression_bptc"},
+   string_view{"ARB_texture_storage"},
+   string_view{"ARB_vertex_attrib_binding"},
+   string_view{"EXT_texture_compression_s3tc"},
+   string_view{"EXT_texture_filter_anisotropic"},
+   string_view{"KHR_debug"},
+   string_view{"KHR_no_error"},
+   string_view{"KHR_parallel_shader_compile"},
+   string_view{"KHR_texture_compression_astc_ldr"},
+   string_view{"NV_path_rendering"}}};
+//------------------------------------------------------------------------------
+constexpr auto gl_extension_name_compare(
+  const string_view l,
+  const string_view r) noexcept -> int {
+    const auto n{l.size() < r.size() ? l.size() : r.size()};
+    for(span_size_t i = 0; i < n; ++i) {
+        if(l[i] < r[i]) {
+            return -1;
+        }
+        if(r[i] < l[i]) {
+            return 1;
+        }
+    }
+    return l.size() < r.size() ? -1 : (r.size() < l.size() ? 1 : 0);
+}
+//------------------------------------------------------------------------------
+/// @brief Returns the index of the specified extension in known_gl_extensions.
+/// @ingroup gl_api_wrap
+/// @see known_gl_extensions
+///
+/// The name can be specified with or without the GL_ prefix.
+/// Returns a negative value if the extension is not in the list.
+export constexpr auto find_known_gl_extension(string_view name) noexcept
+  -> span_size_t {
+    if(starts_with(name, string_view{"GL_"})) {
+        name = skip(name, 3);
+    }
+    span_size_t lo{0};
+    span_size_t hi{span_size(known_gl_extensions.size())};
+    while(lo < hi) {
+        const auto mid{lo + (hi - lo) / 2};
+        const auto cmp{gl_extension_name_compare(
+          known_gl_extensions[std_size(mid)], name)};
+        if(cmp < 0) {
+            lo = mid + 1;
+        } else if(cmp > 0) {
+            hi = mid;
+        } else {
+            return mid;
+        }
+    }
+    return -1;
+}
+//------------------------------------------------------------------------------
+/// @brief Per-context cache of the availability of the known GL extensions.
+/// @ingroup gl_api_wrap
+/// @see known_gl_extensions
+export class gl_extension_table {
+public:
+    /// @brief Indicates if the availability flags were already resolved.
+    auto is_resolved() const noexcept -> bool {
+        return _resolved;
+    }
+
+    /// @brief Marks the specified driver-reported extension as available.
+    /// @see find_known_gl_extension
+    void add(const string_view name) noexcept {
+        if(const auto index{find_known_gl_extension(name)}; index >= 0) {
+            _available.set(std_size(index));
+        }
+    }
+
+    /// @brief Marks the table as resolved after all extensions were added.
+    void mark_resolved() noexcept {
+        _resolved = true;
+    }
+
+    /// @brief Clears the cached flags, forcing a re-query on next use.
+    void reset() noexcept {
+        _available.reset();
+        _resolved = false;
+    }
 
+    /// @brief Tests if the known extension with the specified index is available.
+    auto has(const span_size_t index) const noexcept -> bool {
+        return _available.test(std_size(index));
+    }
+
+    /// @brief Returns the number of the available known extensions.
+    auto available_count() const noexcept -> span_size_t {
+        return span_size(_available.count());
+    }
+
+private:
+    std::bitset<std::tuple_size_v<decltype(known_gl_extensions)>> _available{};
+    bool _resolved{false};
+};
+//------------------------------------------------------------------------------
 /// @brief Wrapper for GL extension information getter.
 /// @ingroup gl_api_wrap
 export template <typename ApiTraits>
@@ -23,22 +149,35 @@ public:
       const string_view name,
       const basic_gl_operations<ApiTraits>& api) noexcept
       : _api{api}
-      , _name{name} {}
+      , _name{name}
+      , _index{find_known_gl_extension(name)} {}
 
     /// @brief Tests if this extension is available.
     explicit operator bool() const noexcept {
-        return _api.has_extension(_name);
+        return _is_available();
     }
 
     /// @brief Tests if this extension is available.
     auto operator()() const noexcept -> bool {
-        return _api.has_extension(_name);
+        return _is_available();
+    }
+
+    /// @brief Returns the name of this extension.
+    auto name() const noexcept -> string_view {
+        return _name;
     }
 
 private:
+    auto _is_available() const noexcept -> bool {
+        if(_index >= 0) [[likely]] {
+            return _api.has_known_extension(_index);
+        }
+        return _api.has_extension(_name);
+    }
+
     const basic_gl_operations<ApiTraits>& _api;
     string_view _name;
+    span_size_t _index;
 };
-
+//------------------------------------------------------------------------------
 } // namespace eagine::oglplus
-
@@ -0,0 +1,74 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+
+#include <eagine/testing/unit_begin.hpp>
+import std;
+import eagine.core;
+import eagine.oglplus;
+//------------------------------------------------------------------------------
+void extensions_known_sorted(auto& s) {
+    eagitest::case_ test{s, 1, "known extensions sorted"};
+    using eagine::oglplus::find_known_gl_extension;
+    using eagine::oglplus::known_gl_extensions;
+
+    for(std::size_t i = 0; i < known_gl_extensions.size(); ++i) {
+        test.check_equal(
+          find_known_gl_extension(known_gl_extensions[i]),
+          eagine::span_size(i),
+          known_gl_extensions[i]);
+    }
+}
+//------------------------------------------------------------------------------
+void extensions_find_known(auto& s) {
+    eagitest::case_ test{s, 2, "find known extension"};
+    using eagine::oglplus::find_known_gl_extension;
+
+    test.check(find_known_gl_extension("ARB_debug_output") >= 0, "ARB 1");
+    test.check(find_known_gl_extension("GL_ARB_debug_output") >= 0, "ARB 2");
+    test.check_equal(
+      find_known_gl_extension("NV_path_rendering"),
+      find_known_gl_extension("GL_NV_path_rendering"),
+      "NV");
+    test.check(find_known_gl_extension("FOO_bar") < 0, "unknown");
+    test.check(find_known_gl_extension("") < 0, "empty");
+    test.check(find_known_gl_extension("GL_") < 0, "prefix");
+}
+//------------------------------------------------------------------------------
+void extensions_table(auto& s) {
+    eagitest::case_ test{s, 3, "extension table"};
+    using eagine::oglplus::find_known_gl_extension;
+
+    eagine::oglplus::gl_extension_table table;
+    test.check(not table.is_resolved(), "not resolved");
+
+    table.add("GL_ARB_robustness");
+    table.add("GL_KHR_debug");
+    table.add("GL_XYZ_unknown");
+    table.mark_resolved();
+
+    test.check(table.is_resolved(), "resolved");
+    test.check_equal(table.available_count(), 2, "count");
+    test.check(table.has(find_known_gl_extension("ARB_robustness")), "has 1");
+    test.check(table.has(find_known_gl_extension("KHR_debug")), "has 2");
+    test.check(
+      not table.has(find_known_gl_extension("NV_path_rendering")), "has 3");
+
+    table.reset();
+    test.check(not table.is_resolved(), "reset");
+    test.check_equal(table.available_count(), 0, "count 0");
+}
+//------------------------------------------------------------------------------
+auto main(int argc, const char** argv) -> int {
+    eagitest::suite test{argc, argv, "extensions", 3};
+    test.once(extensions_known_sorted);
+    test.once(extensions_find_known);
+    test.once(extensions_table);
+    return test.exit_code();
+}
+//------------------------------------------------------------------------------
+#include <eagine/testing/unit_end.hpp>
@@ -0,0 +1,805 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.oglplus:function_names;
+import std;
+
+namespace eagine::oglplus {
+//------------------------------------------------------------------------------
+/// @brief Sorted table of the full names of all GL functions in basic_gl_c_api.
+/// @ingroup gl_api_wrap
+/// @see gl_api_traits
+///
+/// The entries are null-terminated string literals, so they can be passed
+/// directly to the platform function lookup. Allows to resolve all entry
+/// points in a single pass instead of building each name when it is linked.
+export inline constexpr std::array<std::string_view, 765> gl_function_names{{
+  "glActiveShaderProgram",
+  "glActiveTexture",
+  "glAttachShader",
+  "glBegin",
+  "glBeginConditionalRender",
+  "glBeginQuery",
+  "glBeginQueryIndexed",
+  "glBeginTransformFeedback",
+  "glBindAttribLocation",
+  "glBindBuffer",
+  "glBindBufferBase",
+  "glBindBufferRange",
+  "glBindFragDataLocation",
+  "glBindFragDataLocationIndexed",
+  "glBindFramebuffer",
+  "glBindImageTexture",
+  "glBindImageTextures",
+  "glBindProgramPipeline",
+  "glBindRenderbuffer",
+  "glBindSampler",
+  "glBindSamplers",
+  "glBindTexture",
+  "glBindTextureUnit",
+  "glBindTextures",
+  "glBindTransformFeedback",
+  "glBindVertexArray",
+  "glBindVertexBuffer",
+  "glBindVertexBuffers",
+  "glBlendColor",
+  "glBlendEquation",
+  "glBlendEquationSeparate",
+  "glBlendEquationSeparatei",
+  "glBlendEquationi",
+  "glBlendFunc",
+  "glBlendFuncSeparate",
+  "glBlendFuncSeparatei",
+  "glBlendFunci",
+  "glBlitFramebuffer",
+  "glBlitNamedFramebuffer",
+  "glBufferData",
+  "glBufferStorage",
+  "glBufferSubData",
+  "glCheckFramebufferStatus",
+  "glCheckNamedFramebufferStatus",
+  "glClampColor",
+  "glClear",
+  "glClearBufferData",
+  "glClearBufferSubData",
+  "glClearBufferfi",
+  "glClearBufferfv",
+  "glClearBufferiv",
+  "glClearBufferuiv",
+  "glClearColor",
+  "glClearDepth",
+  "glClearDepthf",
+  "glClearNamedBufferData",
+  "glClearNamedBufferSubData",
+  "glClearNamedFramebufferfi",
+  "glClearNamedFramebufferfv",
+  "glClearNamedFramebufferiv",
+  "glClearNamedFramebufferuiv",
+  "glClearStencil",
+  "glClearTexImage",
+  "glClearTexSubImage",
+  "glClientWaitSync",
+  "glClipControl",
+  "glColor3f",
+  "glColor3i",
+  "glColor4f",
+  "glColor4i",
+  "glColorMask",
+  "glColorMaski",
+  "glCompileShader",
+  "glCompileShaderIncludeARB",
+  "glCompressedTexImage1D",
+  "glCompressedTexImage2D",
+  "glCompressedTexImage3D",
+  "glCompressedTexSubImage1D",
+  "glCompressedTexSubImage2D",
+  "glCompressedTexSubImage3D",
+  "glCompressedTextureSubImage1D",
+  "glCompressedTextureSubImage2D",
+  "glCompressedTextureSubImage3D",
+  "glCopyBufferSubData",
+  "glCopyImageSubData",
+  "glCopyNamedBufferSubData",
+  "glCopyPathNV",
+  "glCopyTexImage1D",
+  "glCopyTexImage2D",
+  "glCopyTexSubImage1D",
+  "glCopyTexSubImage2D",
+  "glCopyTexSubImage3D",
+  "glCopyTextureSubImage1D",
+  "glCopyTextureSubImage2D",
+  "glCopyTextureSubImage3D",
+  "glCoverFillPathInstancedNV",
+  "glCoverFillPathNV",
+  "glCoverStrokePathInstancedNV",
+  "glCoverStrokePathNV",
+  "glCreateBuffers",
+  "glCreateFramebuffers",
+  "glCreateProgram",
+  "glCreateProgramPipelines",
+  "glCreateQueries",
+  "glCreateRenderbuffers",
+  "glCreateSamplers",
+  "glCreateShader",
+  "glCreateShaderProgramv",
+  "glCreateTextures",
+  "glCreateTransformFeedbacks",
+  "glCreateVertexArrays",
+  "glCullFace",
+  "glDebugMessageCallback",
+  "glDebugMessageControl",
+  "glDebugMessageInsert",
+  "glDeleteBuffers",
+  "glDeleteFramebuffers",
+  "glDeleteNamedStringARB",
+  "glDeletePathsNV",
+  "glDeleteProgram",
+  "glDeleteProgramPipelines",
+  "glDeleteQueries",
+  "glDeleteRenderbuffers",
+  "glDeleteSamplers",
+  "glDeleteShader",
+  "glDeleteSync",
+  "glDeleteTextures",
+  "glDeleteTransformFeedbacks",
+  "glDeleteVertexArrays",
+  "glDepthFunc",
+  "glDepthMask",
+  "glDepthRange",
+  "glDepthRangeArrayv",
+  "glDepthRangeIndexed",
+  "glDepthRangef",
+  "glDetachShader",
+  "glDisable",
+  "glDisableVertexArrayAttrib",
+  "glDisableVertexAttribArray",
+  "glDisablei",
+  "glDispatchCompute",
+  "glDispatchComputeIndirect",
+  "glDrawArrays",
+  "glDrawArraysIndirect",
+  "glDrawArraysInstanced",
+  "glDrawArraysInstancedBaseInstance",
+  "glDrawBuffer",
+  "glDrawBuffers",
+  "glDrawElements",
+  "glDrawElementsBaseVertex",
+  "glDrawElementsIndirect",
+  "glDrawElementsInstanced",
+  "glDrawElementsInstancedBaseInstance",
+  "glDrawElementsInstancedBaseVertex",
+  "glDrawElementsInstancedBaseVertexBaseInstance",
+  "glDrawRangeElements",
+  "glDrawRangeElementsBaseVertex",
+  "glDrawTransformFeedback",
+  "glDrawTransformFeedbackInstanced",
+  "glDrawTransformFeedbackStream",
+  "glDrawTransformFeedbackStreamInstanced",
+  "glEnable",
+  "glEnableVertexArrayAttrib",
+  "glEnableVertexAttribArray",
+  "glEnablei",
+  "glEnd",
+  "glEndConditionalRender",
+  "glEndQuery",
+  "glEndQueryIndexed",
+  "glEndTransformFeedback",
+  "glFenceSync",
+  "glFinish",
+  "glFlush",
+  "glFlushMappedBufferRange",
+  "glFlushMappedNamedBufferRange",
+  "glFramebufferParameteri",
+  "glFramebufferRenderbuffer",
+  "glFramebufferTexture",
+  "glFramebufferTexture1D",
+  "glFramebufferTexture2D",
+  "glFramebufferTexture3D",
+  "glFramebufferTextureLayer",
+  "glFrontFace",
+  "glFrustum",
+  "glGenBuffers",
+  "glGenFramebuffers",
+  "glGenPathsNV",
+  "glGenProgramPipelines",
+  "glGenQueries",
+  "glGenRenderbuffers",
+  "glGenSamplers",
+  "glGenTextures",
+  "glGenTransformFeedbacks",
+  "glGenVertexArrays",
+  "glGenerateMipmap",
+  "glGenerateTextureMipmap",
+  "glGetActiveAttrib",
+  "glGetActiveSubroutineName",
+  "glGetActiveSubroutineUniformName",
+  "glGetActiveSubroutineUniformiv",
+  "glGetActiveUniformName",
+  "glGetAttachedShaders",
+  "glGetAttribLocation",
+  "glGetBooleani_v",
+  "glGetBooleanv",
+  "glGetBufferParameteri64v",
+  "glGetBufferParameteriv",
+  "glGetBufferSubData",
+  "glGetCompressedTexImage",
+  "glGetCompressedTextureImage",
+  "glGetCompressedTextureSubImage",
+  "glGetDebugMessageLog",
+  "glGetDoublei_v",
+  "glGetDoublev",
+  "glGetError",
+  "glGetFloati_v",
+  "glGetFloatv",
+  "glGetFragDataIndex",
+  "glGetFragDataLocation",
+  "glGetFramebufferAttachmentParameteriv",
+  "glGetFramebufferParameteriv",
+  "glGetGraphicsResetStatus",
+  "glGetImageHandleARB",
+  "glGetInteger64i_v",
+  "glGetInteger64v",
+  "glGetIntegeri_v",
+  "glGetIntegerv",
+  "glGetInternalformati64v",
+  "glGetInternalformativ",
+  "glGetMultisamplefv",
+  "glGetNamedBufferParameteri64v",
+  "glGetNamedBufferParameteriv",
+  "glGetNamedBufferSubData",
+  "glGetNamedFramebufferAttachmentParameteriv",
+  "glGetNamedFramebufferParameteriv",
+  "glGetNamedRenderbufferParameteriv",
+  "glGetNamedStringARB",
+  "glGetNamedStringivARB",
+  "glGetObjectLabel",
+  "glGetObjectPtrLabel",
+  "glGetPathColorGenfvNV",
+  "glGetPathColorGenivNV",
+  "glGetPathCommandsNV",
+  "glGetPathCoordsNV",
+  "glGetPathDashArrayNV",
+  "glGetPathLengthNV",
+  "glGetPathMetricRangeNV",
+  "glGetPathMetricsNV",
+  "glGetPathParameterfvNV",
+  "glGetPathParameterivNV",
+  "glGetPathSpacingNV",
+  "glGetPathTexGenfvNV",
+  "glGetPathTexGenivNV",
+  "glGetPointerv",
+  "glGetProgramBinary",
+  "glGetProgramInfoLog",
+  "glGetProgramInterfaceiv",
+  "glGetProgramPipelineInfoLog",
+  "glGetProgramPipelineiv",
+  "glGetProgramResourceIndex",
+  "glGetProgramResourceLocation",
+  "glGetProgramResourceLocationIndex",
+  "glGetProgramResourceName",
+  "glGetProgramResourcefvNV",
+  "glGetProgramResourceiv",
+  "glGetProgramStageiv",
+  "glGetProgramiv",
+  "glGetQueryBufferObjecti64v",
+  "glGetQueryBufferObjectiv",
+  "glGetQueryBufferObjectui64v",
+  "glGetQueryBufferObjectuiv",
+  "glGetQueryIndexediv",
+  "glGetQueryObjecti64v",
+  "glGetQueryObjectiv",
+  "glGetQueryObjectui64v",
+  "glGetQueryObjectuiv",
+  "glGetQueryiv",
+  "glGetRenderbufferParameteriv",
+  "glGetSamplerParameterIiv",
+  "glGetSamplerParameterIuiv",
+  "glGetSamplerParameterfv",
+  "glGetSamplerParameteriv",
+  "glGetShaderInfoLog",
+  "glGetShaderPrecisionFormat",
+  "glGetShaderSource",
+  "glGetShaderiv",
+  "glGetString",
+  "glGetStringi",
+  "glGetSubroutineIndex",
+  "glGetSubroutineUniformLocation",
+  "glGetSynciv",
+  "glGetTexImage",
+  "glGetTexLevelParameterfv",
+  "glGetTexLevelParameteriv",
+  "glGetTexParameterIiv",
+  "glGetTexParameterIuiv",
+  "glGetTexParameterfv",
+  "glGetTexParameteriv",
+  "glGetTextureHandleARB",
+  "glGetTextureImage",
+  "glGetTextureLevelParameterfv",
+  "glGetTextureLevelParameteriv",
+  "glGetTextureParameterIiv",
+  "glGetTextureParameterIuiv",
+  "glGetTextureParameterfv",
+  "glGetTextureParameteriv",
+  "glGetTextureSamplerHandleARB",
+  "glGetTextureSubImage",
+  "glGetTransformFeedbackVarying",
+  "glGetTransformFeedbacki64_v",
+  "glGetTransformFeedbacki_v",
+  "glGetTransformFeedbackiv",
+  "glGetUniformBlockIndex",
+  "glGetUniformLocation",
+  "glGetUniformSubroutineuiv",
+  "glGetUniformdv",
+  "glGetUniformfv",
+  "glGetUniformiv",
+  "glGetUniformuiv",
+  "glGetVertexArrayIndexed64iv",
+  "glGetVertexArrayIndexediv",
+  "glGetVertexArrayiv",
+  "glGetVertexAttribIiv",
+  "glGetVertexAttribIuiv",
+  "glGetVertexAttribLdv",
+  "glGetVertexAttribPointerv",
+  "glGetVertexAttribdv",
+  "glGetVertexAttribfv",
+  "glGetVertexAttribiv",
+  "glGetnCompressedTexImage",
+  "glGetnTexImage",
+  "glGetnUniformdv",
+  "glGetnUniformfv",
+  "glGetnUniformiv",
+  "glGetnUniformuiv",
+  "glHint",
+  "glInterpolatePathsNV",
+  "glInvalidateBufferData",
+  "glInvalidateBufferSubData",
+  "glInvalidateFramebuffer",
+  "glInvalidateNamedFramebufferData",
+  "glInvalidateNamedFramebufferSubData",
+  "glInvalidateSubFramebuffer",
+  "glInvalidateTexImage",
+  "glInvalidateTexSubImage",
+  "glIsBuffer",
+  "glIsEnabled",
+  "glIsEnabledi",
+  "glIsFramebuffer",
+  "glIsNamedStringARB",
+  "glIsPathNV",
+  "glIsPointInFillPathNV",
+  "glIsPointInStrokePathNV",
+  "glIsProgram",
+  "glIsProgramPipeline",
+  "glIsQuery",
+  "glIsRenderbuffer",
+  "glIsSampler",
+  "glIsShader",
+  "glIsSync",
+  "glIsTexture",
+  "glIsTransformFeedback",
+  "glIsVertexArray",
+  "glLineWidth",
+  "glLinkProgram",
+  "glLoadIdentity",
+  "glLoadMatrixd",
+  "glLoadMatrixf",
+  "glLoadTransposeMatrixd",
+  "glLoadTransposeMatrixf",
+  "glLogicOp",
+  "glMakeImageHandleNonResidentARB",
+  "glMakeImageHandleResidentARB",
+  "glMakeTextureHandleNonResidentARB",
+  "glMakeTextureHandleResidentARB",
+  "glMapBuffer",
+  "glMapBufferRange",
+  "glMapNamedBuffer",
+  "glMapNamedBufferRange",
+  "glMatrixFrustumEXT",
+  "glMatrixLoad3x2fNV",
+  "glMatrixLoad3x3fNV",
+  "glMatrixLoadIdentityEXT",
+  "glMatrixLoadTranspose3x3fNV",
+  "glMatrixLoadTransposedEXT",
+  "glMatrixLoadTransposefEXT",
+  "glMatrixLoaddEXT",
+  "glMatrixLoadfEXT",
+  "glMatrixMode",
+  "glMatrixMult3x2fNV",
+  "glMatrixMult3x3fNV",
+  "glMatrixMultTranspose3x3fNV",
+  "glMatrixMultTransposedEXT",
+  "glMatrixMultTransposefEXT",
+  "glMatrixMultdEXT",
+  "glMatrixMultfEXT",
+  "glMatrixOrthoEXT",
+  "glMatrixPopEXT",
+  "glMatrixPushEXT",
+  "glMatrixRotatedEXT",
+  "glMatrixRotatefEXT",
+  "glMatrixScaledEXT",
+  "glMatrixScalefEXT",
+  "glMatrixTranslatedEXT",
+  "glMatrixTranslatefEXT",
+  "glMaxShaderCompilerThreadsARB",
+  "glMemoryBarrier",
+  "glMemoryBarrierByRegion",
+  "glMinSampleShading",
+  "glMultMatrixd",
+  "glMultMatrixf",
+  "glMultTransposeMatrixd",
+  "glMultTransposeMatrixf",
+  "glMultiDrawArrays",
+  "glMultiDrawArraysIndirect",
+  "glMultiDrawArraysIndirectCount",
+  "glMultiDrawElements",
+  "glMultiDrawElementsBaseVertex",
+  "glMultiDrawElementsIndirect",
+  "glMultiDrawElementsIndirectCount",
+  "glMultiTexCoord1f",
+  "glMultiTexCoord1i",
+  "glMultiTexCoord2f",
+  "glMultiTexCoord2i",
+  "glMultiTexCoord3f",
+  "glMultiTexCoord3i",
+  "glMultiTexCoord4f",
+  "glMultiTexCoord4i",
+  "glNamedBufferData",
+  "glNamedBufferStorage",
+  "glNamedBufferSubData",
+  "glNamedFramebufferDrawBuffer",
+  "glNamedFramebufferDrawBuffers",
+  "glNamedFramebufferParameteri",
+  "glNamedFramebufferReadBuffer",
+  "glNamedFramebufferRenderbuffer",
+  "glNamedFramebufferTexture",
+  "glNamedFramebufferTextureLayer",
+  "glNamedRenderbufferStorage",
+  "glNamedRenderbufferStorageMultisample",
+  "glNamedStringARB",
+  "glObjectLabel",
+  "glObjectPtrLabel",
+  "glOrtho",
+  "glPatchParameterfv",
+  "glPatchParameteri",
+  "glPathColorGenNV",
+  "glPathCommandsNV",
+  "glPathCoordsNV",
+  "glPathCoverDepthFuncNV",
+  "glPathFogGenNV",
+  "glPathGlyphIndexArrayNV",
+  "glPathGlyphIndexRangeNV",
+  "glPathGlyphRangeNV",
+  "glPathGlyphsNV",
+  "glPathMemoryGlyphIndexArrayNV",
+  "glPathParameterfNV",
+  "glPathParameterfvNV",
+  "glPathParameteriNV",
+  "glPathParameterivNV",
+  "glPathStencilDepthOffsetNV",
+  "glPathStencilFuncNV",
+  "glPathStringNV",
+  "glPathSubCommandsNV",
+  "glPathSubCoordsNV",
+  "glPathTexGenNV",
+  "glPauseTransformFeedback",
+  "glPointAlongPathNV",
+  "glPointParameterf",
+  "glPointParameterfv",
+  "glPointParameteri",
+  "glPointParameteriv",
+  "glPointSize",
+  "glPolygonMode",
+  "glPolygonOffset",
+  "glPolygonOffsetClamp",
+  "glPopDebugGroup",
+  "glPopMatrix",
+  "glPrimitiveRestartIndex",
+  "glProgramBinary",
+  "glProgramParameteri",
+  "glProgramPathFragmentInputGenNV",
+  "glProgramUniform1f",
+  "glProgramUniform1fv",
+  "glProgramUniform1i",
+  "glProgramUniform1iv",
+  "glProgramUniform1ui",
+  "glProgramUniform1uiv",
+  "glProgramUniform2f",
+  "glProgramUniform2fv",
+  "glProgramUniform2i",
+  "glProgramUniform2iv",
+  "glProgramUniform2ui",
+  "glProgramUniform2uiv",
+  "glProgramUniform3f",
+  "glProgramUniform3fv",
+  "glProgramUniform3i",
+  "glProgramUniform3iv",
+  "glProgramUniform3ui",
+  "glProgramUniform3uiv",
+  "glProgramUniform4f",
+  "glProgramUniform4fv",
+  "glProgramUniform4i",
+  "glProgramUniform4iv",
+  "glProgramUniform4ui",
+  "glProgramUniform4uiv",
+  "glProgramUniformHandleui64ARB",
+  "glProgramUniformHandleui64vARB",
+  "glProgramUniformMatrix2fv",
+  "glProgramUniformMatrix2x3fv",
+  "glProgramUniformMatrix2x4fv",
+  "glProgramUniformMatrix3fv",
+  "glProgramUniformMatrix3x2fv",
+  "glProgramUniformMatrix3x4fv",
+  "glProgramUniformMatrix4fv",
+  "glProgramUniformMatrix4x2fv",
+  "glProgramUniformMatrix4x3fv",
+  "glProvokingVertex",
+  "glPushDebugGroup",
+  "glPushMatrix",
+  "glQueryCounter",
+  "glReadBuffer",
+  "glReadPixels",
+  "glReadnPixels",
+  "glReleaseShaderCompiler",
+  "glRenderbufferStorage",
+  "glRenderbufferStorageMultisample",
+  "glResumeTransformFeedback",
+  "glRotated",
+  "glRotatef",
+  "glSampleCoverage",
+  "glSampleMaski",
+  "glSamplerParameterIiv",
+  "glSamplerParameterIuiv",
+  "glSamplerParameterf",
+  "glSamplerParameterfv",
+  "glSamplerParameteri",
+  "glSamplerParameteriv",
+  "glScaled",
+  "glScalef",
+  "glScissor",
+  "glScissorArrayv",
+  "glScissorIndexed",
+  "glScissorIndexedv",
+  "glSecondaryColor3f",
+  "glSecondaryColor3i",
+  "glSecondaryColor4f",
+  "glSecondaryColor4i",
+  "glShaderBinary",
+  "glShaderSource",
+  "glShaderStorageBlockBinding",
+  "glSpecializeShader",
+  "glStencilFillPathInstancedNV",
+  "glStencilFillPathNV",
+  "glStencilFunc",
+  "glStencilFuncSeparate",
+  "glStencilMask",
+  "glStencilMaskSeparate",
+  "glStencilOp",
+  "glStencilOpSeparate",
+  "glStencilStrokePathInstancedNV",
+  "glStencilStrokePathNV",
+  "glStencilThenCoverFillPathInstancedNV",
+  "glStencilThenCoverFillPathNV",
+  "glStencilThenCoverStrokePathInstancedNV",
+  "glStencilThenCoverStrokePathNV",
+  "glTexBuffer",
+  "glTexBufferRange",
+  "glTexCoord1f",
+  "glTexCoord1i",
+  "glTexCoord2f",
+  "glTexCoord2i",
+  "glTexCoord3f",
+  "glTexCoord3i",
+  "glTexCoord4f",
+  "glTexCoord4i",
+  "glTexImage1D",
+  "glTexImage2D",
+  "glTexImage2DMultisample",
+  "glTexImage3D",
+  "glTexImage3DMultisample",
+  "glTexParameterIiv",
+  "glTexParameterIuiv",
+  "glTexParameterf",
+  "glTexParameterfv",
+  "glTexParameteri",
+  "glTexParameteriv",
+  "glTexStorage1D",
+  "glTexStorage2D",
+  "glTexStorage2DMultisample",
+  "glTexStorage3D",
+  "glTexStorage3DMultisample",
+  "glTexSubImage1D",
+  "glTexSubImage2D",
+  "glTexSubImage3D",
+  "glTextureBarrier",
+  "glTextureBuffer",
+  "glTextureBufferRange",
+  "glTextureParameterIiv",
+  "glTextureParameterIuiv",
+  "glTextureParameterf",
+  "glTextureParameterfv",
+  "glTextureParameteri",
+  "glTextureParameteriv",
+  "glTextureStorage1D",
+  "glTextureStorage2D",
+  "glTextureStorage2DMultisample",
+  "glTextureStorage3D",
+  "glTextureStorage3DMultisample",
+  "glTextureSubImage1D",
+  "glTextureSubImage2D",
+  "glTextureSubImage3D",
+  "glTextureView",
+  "glTransformFeedbackBufferBase",
+  "glTransformFeedbackBufferRange",
+  "glTransformFeedbackVaryings",
+  "glTransformPathNV",
+  "glTranslated",
+  "glTranslatef",
+  "glUniform1f",
+  "glUniform1fv",
+  "glUniform1i",
+  "glUniform1iv",
+  "glUniform1ui",
+  "glUniform1uiv",
+  "glUniform2f",
+  "glUniform2fv",
+  "glUniform2i",
+  "glUniform2iv",
+  "glUniform2ui",
+  "glUniform2uiv",
+  "glUniform3f",
+  "glUniform3fv",
+  "glUniform3i",
+  "glUniform3iv",
+  "glUniform3ui",
+  "glUniform3uiv",
+  "glUniform4f",
+  "glUniform4fv",
+  "glUniform4i",
+  "glUniform4iv",
+  "glUniform4ui",
+  "glUniform4uiv",
+  "glUniformBlockBinding",
+  "glUniformHandleui64ARB",
+  "glUniformHandleui64vARB",
+  "glUniformMatrix2fv",
+  "glUniformMatrix2x3fv",
+  "glUniformMatrix2x4fv",
+  "glUniformMatrix3fv",
+  "glUniformMatrix3x2fv",
+  "glUniformMatrix3x4fv",
+  "glUniformMatrix4fv",
+  "glUniformMatrix4x2fv",
+  "glUniformMatrix4x3fv",
+  "glUniformSubroutinesuiv",
+  "glUnmapBuffer",
+  "glUnmapNamedBuffer",
+  "glUseProgram",
+  "glUseProgramStages",
+  "glValidateProgram",
+  "glValidateProgramPipeline",
+  "glVertex2f",
+  "glVertex2i",
+  "glVertex3f",
+  "glVertex3i",
+  "glVertex4f",
+  "glVertex4i",
+  "glVertexArrayAttribBinding",
+  "glVertexArrayAttribFormat",
+  "glVertexArrayAttribIFormat",
+  "glVertexArrayAttribLFormat",
+  "glVertexArrayBindingDivisor",
+  "glVertexArrayElementBuffer",
+  "glVertexArrayVertexBuffer",
+  "glVertexArrayVertexBuffers",
+  "glVertexAttrib1d",
+  "glVertexAttrib1dv",
+  "glVertexAttrib1f",
+  "glVertexAttrib1fv",
+  "glVertexAttrib1s",
+  "glVertexAttrib1sv",
+  "glVertexAttrib2d",
+  "glVertexAttrib2dv",
+  "glVertexAttrib2f",
+  "glVertexAttrib2fv",
+  "glVertexAttrib2s",
+  "glVertexAttrib2sv",
+  "glVertexAttrib3d",
+  "glVertexAttrib3dv",
+  "glVertexAttrib3f",
+  "glVertexAttrib3fv",
+  "glVertexAttrib3s",
+  "glVertexAttrib3sv",
+  "glVertexAttrib4Nbv",
+  "glVertexAttrib4Niv",
+  "glVertexAttrib4Nsv",
+  "glVertexAttrib4Nub",
+  "glVertexAttrib4Nubv",
+  "glVertexAttrib4Nuiv",
+  "glVertexAttrib4Nusv",
+  "glVertexAttrib4bv",
+  "glVertexAttrib4d",
+  "glVertexAttrib4dv",
+  "glVertexAttrib4f",
+  "glVertexAttrib4fv",
+  "glVertexAttrib4iv",
+  "glVertexAttrib4s",
+  "glVertexAttrib4sv",
+  "glVertexAttrib4ubv",
+  "glVertexAttrib4uiv",
+  "glVertexAttrib4usv",
+  "glVertexAttribBinding",
+  "glVertexAttribDivisor",
+  "glVertexAttribFormat",
+  "glVertexAttribI1i",
+  "glVertexAttribI1iv",
+  "glVertexAttribI1ui",
+  "glVertexAttribI1uiv",
+  "glVertexAttribI2i",
+  "glVertexAttribI2iv",
+  "glVertexAttribI2ui",
+  "glVertexAttribI2uiv",
+  "glVertexAttribI3i",
+  "glVertexAttribI3iv",
+  "glVertexAttribI3ui",
+  "glVertexAttribI3uiv",
+  "glVertexAttribI4bv",
+  "glVertexAttribI4i",
+  "glVertexAttribI4iv",
+  "glVertexAttribI4sv",
+  "glVertexAttribI4ubv",
+  "glVertexAttribI4ui",
+  "glVertexAttribI4uiv",
+  "glVertexAttribI4usv",
+  "glVertexAttribIFormat",
+  "glVertexAttribIPointer",
+  "glVertexAttribL1d",
+  "glVertexAttribL1dv",
+  "glVertexAttribL1ui64ARB",
+  "glVertexAttribL1ui64vARB",
+  "glVertexAttribL2d",
+  "glVertexAttribL2dv",
+  "glVertexAttribL3d",
+  "glVertexAttribL3dv",
+  "glVertexAttribL4d",
+  "glVertexAttribL4dv",
+  "glVertexAttribLFormat",
+  "glVertexAttribLPointer",
+  "glVertexAttribP1ui",
+  "glVertexAttribP1uiv",
+  "glVertexAttribP2ui",
+  "glVertexAttribP2uiv",
+  "glVertexAttribP3ui",
+  "glVertexAttribP3uiv",
+  "glVertexAttribP4ui",
+  "glVertexAttribP4uiv",
+  "glVertexAttribPointer",
+  "glVertexBindingDivisor",
+  "glViewport",
+  "glViewportArrayv",
+  "glViewportIndexedf",
+  "glViewportIndexedfv",
+  "glWaitSync",
+  "glWeightPathsNV",
+}};
+//------------------------------------------------------------------------------
+static_assert(std::ranges::is_sorted(gl_function_names));
+//------------------------------------------------------------------------------
+/// @brief Returns the index of a GL function name (without "gl") in the table.
+/// @ingroup gl_api_wrap
+/// @see gl_function_names
+export constexpr auto find_gl_function_name(std::string_view name) noexcept
+  -> std::optional<std::size_t> {
+    const auto pos{std::ranges::lower_bound(
+      gl_function_names, name, std::less<>{}, [](std::string_view entry) {
+          return entry.substr(2);
+      })};
+    if((pos != gl_function_names.end()) and (pos->substr(2) == name)) {
+        return {std::size_t(std::distance(gl_function_names.begin(), pos))};
+    }
+    return {};
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::oglplus
@@ -0,0 +1,272 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.oglplus:geometry_arena;
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.valid_if;
+import eagine.shapes;
+import :config;
+import :enum_types;
+import :objects;
+import :prog_var_loc;
+import :api;
+import :shapes;
+
+namespace eagine::oglplus {
+//------------------------------------------------------------------------------
+/// @brief First-fit allocator of ranges within a fixed-capacity buffer.
+/// @ingroup shapes
+/// @see geometry_arena
+///
+/// Released ranges are merged with adjacent free ranges.
+export class buffer_range_allocator {
+public:
+    /// @brief Construction with the specified capacity and range alignment.
+    buffer_range_allocator(
+      const span_size_t capacity,
+      const span_size_t alignment) noexcept;
+
+    /// @brief Returns the total capacity of the managed range.
+    auto capacity() const noexcept -> span_size_t {
+        return _capacity;
+    }
+
+    /// @brief Returns the number of currently allocated units.
+    auto used() const noexcept -> span_size_t {
+        return _used;
+    }
+
+    /// @brief Returns the number of free ranges (a measure of fragmentation).
+    auto free_range_count() const noexcept -> span_size_t {
+        return span_size(_free.size());
+    }
+
+    /// @brief Returns the size of the largest free range.
+    auto largest_free_range() const noexcept -> span_size_t;
+
+    /// @brief Returns the end of the last allocated range.
+    auto high_water_mark() const noexcept -> span_size_t;
+
+    /// @brief Indicates if there are free ranges below the high-water mark.
+    /// @see geometry_arena::compact
+    auto has_gaps() const noexcept -> bool {
+        return not _free.empty() and (_free.front().offset < high_water_mark());
+    }
+
+    /// @brief Allocates a range of the specified size, returns its offset.
+    auto allocate(const span_size_t size) noexcept
+      -> optionally_valid<span_size_t>;
+
+    /// @brief Returns a previously allocated range back to the allocator.
+    void release(const span_size_t offset, const span_size_t size) noexcept;
+
+    /// @brief Marks the first used units as allocated and the rest as free.
+    /// @see geometry_arena::compact
+    void reset(const span_size_t used) noexcept;
+
+    /// @brief Rounds the specified size up to the range alignment.
+    auto aligned(const span_size_t size) const noexcept -> span_size_t {
+        return (size + _alignment - 1) / _alignment * _alignment;
+    }
+
+private:
+    struct free_range {
+        span_size_t offset;
+        span_size_t size;
+    };
+
+    std::vector<free_range> _free;
+    span_size_t _capacity;
+    span_size_t _alignment;
+    span_size_t _used{0};
+};
+//------------------------------------------------------------------------------
+/// @brief Lightweight handle referencing a shape stored in a geometry_arena.
+/// @ingroup shapes
+/// @see geometry_arena
+export struct geometry_arena_handle {
+    /// @brief The index of the entry in the arena.
+    span_size_t slot{-1};
+
+    /// @brief Indicates if this handle references an arena entry.
+    explicit operator bool() const noexcept {
+        return slot >= 0;
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Placement of a shape inside the shared buffers of a geometry_arena.
+/// @ingroup shapes
+/// @see geometry_arena
+export struct geometry_arena_entry {
+    /// @brief The draw operations, with first index offsets already applied.
+    std::vector<shape_draw_operation> ops;
+    /// @brief The index of the arena pool storing the shape.
+    span_size_t pool{-1};
+    /// @brief The index of the first vertex of the shape in the vertex buffer.
+    span_size_t base_vertex{0};
+    /// @brief The number of vertices of the shape.
+    span_size_t vertex_count{0};
+    /// @brief The byte offset of the first index in the index buffer.
+    span_size_t first_index{0};
+    /// @brief The byte size of the indices of the shape.
+    span_size_t index_size{0};
+
+    /// @brief Indicates if the entry is in use.
+    auto is_live() const noexcept -> bool {
+        return pool >= 0;
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Stores many shapes in a few large vertex and index buffers.
+/// @ingroup shapes
+/// @see geometry
+/// @see geometry_arena_handle
+///
+/// Shapes with the same vertex format (as given by the attribute bindings
+/// and the attribute data types) share one vertex array object and one pair
+/// of vertex and index buffers. The vertex attributes are interleaved and
+/// the shapes are drawn with draw_elements_base_vertex, so drawing many
+/// shapes from the same pool needs a single vertex array bind.
+export class geometry_arena {
+public:
+    /// @brief Construction with per-pool vertex count and index byte capacity.
+    geometry_arena(
+      const span_size_t vertex_capacity,
+      const span_size_t index_capacity) noexcept
+      : _vertex_capacity{vertex_capacity}
+      , _index_capacity{index_capacity} {}
+
+    geometry_arena(geometry_arena&&) noexcept = default;
+    geometry_arena(const geometry_arena&) = delete;
+    auto operator=(geometry_arena&&) noexcept -> geometry_arena& = default;
+    auto operator=(const geometry_arena&) = delete;
+    ~geometry_arena() noexcept = default;
+
+    /// @brief Places the specified shape into the arena.
+    /// @see remove
+    ///
+    /// Returns an invalid handle if the shape does not fit into an empty pool
+    /// or if it is instanced or has per-instance (divisor) attributes.
+    auto add(
+      const gl_api& glapi,
+      const shape_generator& shape,
+      const vertex_attrib_bindings& bindings,
+      const shapes::drawing_variant var,
+      memory::buffer& temp) -> geometry_arena_handle;
+
+    /// @brief Places the default drawing variant of a shape into the arena.
+    auto add(
+      const gl_api& glapi,
+      const shape_generator& shape,
+      const vertex_attrib_bindings& bindings,
+      memory::buffer& temp) -> geometry_arena_handle {
+        return add(glapi, shape, bindings, shape.draw_variant(0), temp);
+    }
+
+    /// @brief Removes the referenced shape, reclaiming its buffer ranges.
+    /// @see compact
+    void remove(const geometry_arena_handle handle) noexcept;
+
+    /// @brief Moves the live shapes to the beginning of the shared buffers.
+    /// @see remove
+    ///
+    /// Handles remain valid, base vertex and first index of the entries
+    /// are updated. Returns the number of shapes that were moved.
+    auto compact(const gl_api& glapi) -> span_size_t;
+
+    /// @brief Returns the placement information of the referenced shape.
+    /// @pre handle is valid
+    auto entry(const geometry_arena_handle handle) const noexcept
+      -> const geometry_arena_entry& {
+        return _entries[std_size(handle.slot)];
+    }
+
+    /// @brief Returns the number of shapes stored in the arena.
+    auto shape_count() const noexcept -> span_size_t {
+        return span_size(_entries.size() - _free_slots.size());
+    }
+
+    /// @brief Returns the number of vertex formats / buffer pools.
+    auto pool_count() const noexcept -> span_size_t {
+        return span_size(_pools.size());
+    }
+
+    /// @brief Binds the vertex array of the pool storing the referenced shape.
+    void use(const gl_api& glapi, const geometry_arena_handle handle) const;
+
+    /// @brief Draws the referenced shape, skipping redundant state changes.
+    /// @pre use was called for a shape from the same pool
+    void draw(
+      const gl_api& glapi,
+      const geometry_arena_handle handle,
+      shape_draw_state& state) const;
+
+    /// @brief Draws the referenced shape.
+    /// @pre use was called for a shape from the same pool
+    void draw(const gl_api& glapi, const geometry_arena_handle handle) const {
+        shape_draw_state state;
+        draw(glapi, handle, state);
+    }
+
+    /// @brief Draws the referenced shapes, binding vertex arrays when needed.
+    ///
+    /// Sorting the handles by pool minimizes the number of vertex array binds.
+    void draw(
+      const gl_api& glapi,
+      const span<const geometry_arena_handle> handles) const;
+
+    /// @brief Releases the used OpenGL resources.
+    void clean_up(const gl_api& glapi);
+
+private:
+    struct attrib_format {
+        vertex_attrib_location location;
+        data_type type;
+        span_size_t offset;
+        span_size_t values;
+        span_size_t divisor;
+        bool integral;
+        bool normalized;
+
+        friend auto operator==(const attrib_format&, const attrib_format&)
+          -> bool = default;
+    };
+
+    struct pool {
+        std::vector<attrib_format> format;
+        span_size_t stride{0};
+        buffer_range_allocator vertices;
+        buffer_range_allocator indices;
+        owned_vertex_array_name vao;
+        owned_buffer_name vbo;
+        owned_buffer_name ibo;
+    };
+
+    auto _format_of(
+      const gl_api& glapi,
+      const shape_generator& shape,
+      const vertex_attrib_bindings& bindings,
+      const interleaved_attrib_layout& layout) const
+      -> std::vector<attrib_format>;
+
+    auto _make_pool(
+      const gl_api& glapi,
+      std::vector<attrib_format> format,
+      const span_size_t stride) -> span_size_t;
+
+    void _setup_vao(const gl_api& glapi, const pool&) const;
+
+    span_size_t _vertex_capacity;
+    span_size_t _index_capacity;
+    std::vector<pool> _pools;
+    std::vector<geometry_arena_entry> _entries;
+    std::vector<span_size_t> _free_slots;
+};
+//------------------------------------------------------------------------------
+} // namespace eagine::oglplus
@@ -0,0 +1,468 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#include <cassert>
+
+module eagine.oglplus;
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import eagine.core.valid_if;
+import eagine.shapes;
+
+namespace eagine::oglplus {
+//------------------------------------------------------------------------------
+// buffer_range_allocator
+//------------------------------------------------------------------------------
+buffer_range_allocator::buffer_range_allocator(
+  const span_size_t capacity,
+  const span_size_t alignment) noexcept
+  : _capacity{capacity}
+  , _alignment{std::max(alignment, span_size_t(1))} {
+    if(_capacity > 0) {
+        _free.push_back({0, _capacity});
+    }
+}
+//------------------------------------------------------------------------------
+auto buffer_range_allocator::largest_free_range() const noexcept
+  -> span_size_t {
+    span_size_t result{0};
+    for(const auto& range : _free) {
+        result = std::max(result, range.size);
+    }
+    return result;
+}
+//------------------------------------------------------------------------------
+auto buffer_range_allocator::allocate(const span_size_t size) noexcept
+  -> optionally_valid<span_size_t> {
+    if(size <= 0) {
+        return {0, true};
+    }
+    const auto aligned_size{aligned(size)};
+    const auto pos{
+      std::find_if(_free.begin(), _free.end(), [=](const auto& range) {
+          return range.size >= aligned_size;
+      })};
+    if(pos == _free.end()) {
+        return {};
+    }
+    const auto offset{pos->offset};
+    pos->offset += aligned_size;
+    pos->size -= aligned_size;
+    if(pos->size == 0) {
+        _free.erase(pos);
+    }
+    _used += aligned_size;
+    return {offset, true};
+}
+//------------------------------------------------------------------------------
+void buffer_range_allocator::release(
+  const span_size_t offset,
+  const span_size_t size) noexcept {
+    if(size <= 0) {
+        return;
+    }
+    const auto aligned_size{aligned(size)};
+    assert(_used >= aligned_size);
+    _used -= aligned_size;
+
+    auto pos{std::lower_bound(
+      _free.begin(), _free.end(), offset, [](const auto& range, auto offs) {
+          return range.offset < offs;
+      })};
+    pos = _free.insert(pos, {offset, aligned_size});
+
+    const auto next{std::next(pos)};
+    if(next != _free.end() and (pos->offset + pos->size == next->offset)) {
+        pos->size += next->size;
+        _free.erase(next);
+    }
+    if(pos != _free.begin()) {
+        const auto prev{std::prev(pos)};
+        if(prev->offset + prev->size == pos->offset) {
+            prev->size += pos->size;
+            _free.erase(pos);
+        }
+    }
+}
+//------------------------------------------------------------------------------
+auto buffer_range_allocator::high_water_mark() const noexcept -> span_size_t {
+    if(not _free.empty()) {
+        const auto& last{_free.back()};
+        if(last.offset + last.size == _capacity) {
+            return last.offset;
+        }
+    }
+    return _capacity;
+}
+//------------------------------------------------------------------------------
+void buffer_range_allocator::reset(const span_size_t used) noexcept {
+    assert(used <= _capacity);
+    _free.clear();
+    _used = used;
+    if(_used < _capacity) {
+        _free.push_back({_used, _capacity - _used});
+    }
+}
+//------------------------------------------------------------------------------
+// geometry_arena
+//------------------------------------------------------------------------------
+auto geometry_arena::_format_of(
+  const gl_api& glapi,
+  const shape_generator& shape,
+  const vertex_attrib_bindings& bindings,
+  const interleaved_attrib_layout& layout) const
+  -> std::vector<attrib_format> {
+    std::vector<attrib_format> result;
+    result.reserve(layout.offsets.size());
+    for(const auto i : integer_range(bindings.attrib_count())) {
+        const auto vav{bindings.attrib_variant(i)};
+        result.push_back(
+          {.location = bindings.location(vav),
+           .type = shape.attrib_type(glapi, vav),
+           .offset = layout.offsets[std_size(i)],
+           .values = shape.values_per_vertex(vav),
+           .divisor = shape.attrib_divisors()
+                        ? span_size(shape.attrib_divisor(vav))
+                        : span_size_t(0),
+           .integral = shape.is_attrib_integral(vav),
+           .normalized = bool(shape.is_attrib_normalized(glapi, vav))});
+    }
+    return result;
+}
+//------------------------------------------------------------------------------
+void geometry_arena::_setup_vao(const gl_api& glapi, const pool& pl) const {
+    const auto& [gl, GL] = glapi;
+
+    gl.bind_vertex_array(pl.vao);
+    gl.bind_buffer(GL.array_buffer, pl.vbo);
+    gl.bind_buffer(GL.element_array_buffer, pl.ibo);
+
+    const auto stride{limit_cast<gl_types::sizei_type>(pl.stride)};
+    for(const auto& attrib : pl.format) {
+        const auto values{limit_cast<gl_types::int_type>(attrib.values)};
+        const auto ptr{reinterpret_cast<const void*>(
+          static_cast<std::intptr_t>(attrib.offset))};
+        if(attrib.integral and not attrib.normalized) [[unlikely]] {
+            gl.vertex_attrib_ipointer(
+              attrib.location, values, attrib.type, stride, ptr);
+        } else {
+            gl.vertex_attrib_pointer(
+              attrib.location,
+              values,
+              attrib.type,
+              attrib.normalized ? GL.true_ : GL.false_,
+              stride,
+              ptr);
+        }
+        gl.vertex_attrib_divisor(
+          attrib.location, limit_cast<gl_types::uint_type>(attrib.divisor));
+        gl.enable_vertex_attrib_array(attrib.location);
+    }
+}
+//------------------------------------------------------------------------------
+auto geometry_arena::_make_pool(
+  const gl_api& glapi,
+  std::vector<attrib_format> format,
+  const span_size_t stride) -> span_size_t {
+    const auto& [gl, GL] = glapi;
+
+    pool pl{
+      .format = std::move(format),
+      .stride = stride,
+      .vertices = {_vertex_capacity, 1},
+      .indices = {_index_capacity, 4},
+      .vao = {},
+      .vbo = {},
+      .ibo = {}};
+    gl.gen_vertex_arrays() >> pl.vao;
+    gl.gen_buffers() >> pl.vbo;
+    gl.gen_buffers() >> pl.ibo;
+
+    // the storage is allocated once, without data, and then filled
+    // with sub-data updates
+    gl.bind_buffer(GL.copy_write_buffer, pl.vbo);
+    gl.buffer_data(
+      GL.copy_write_buffer,
+      memory::const_block{
+        memory::typed_nullptr<const byte>, _vertex_capacity * stride},
+      GL.static_draw);
+    gl.bind_buffer(GL.copy_write_buffer, pl.ibo);
+    gl.buffer_data(
+      GL.copy_write_buffer,
+      memory::const_block{memory::typed_nullptr<const byte>, _index_capacity},
+      GL.static_draw);
+
+    _setup_vao(glapi, pl);
+    _pools.push_back(std::move(pl));
+    return span_size(_pools.size()) - 1;
+}
+//------------------------------------------------------------------------------
+auto geometry_arena::add(
+  const gl_api& glapi,
+  const shape_generator& shape,
+  const vertex_attrib_bindings& bindings,
+  const shapes::drawing_variant var,
+  memory::buffer& temp) -> geometry_arena_handle {
+    const auto& [gl, GL] = glapi;
+
+    const auto layout{shape.interleaved_layout(bindings)};
+    auto format{_format_of(glapi, shape, bindings, layout)};
+    // the shapes are drawn with a base vertex, which does not offset
+    // the per-instance attributes, and as a single instance
+    if(
+      (shape.instance_count() > 1) or
+      std::any_of(format.begin(), format.end(), [](const auto& attrib) {
+          return attrib.divisor != 0;
+      })) {
+        return {};
+    }
+    const bool indexed{shape.indexed_drawing(var)};
+    const auto index_size{indexed ? shape.index_data_block_size(var) : 0};
+
+    geometry_arena_entry entry;
+    entry.vertex_count = layout.vertex_count;
+    entry.index_size = index_size;
+
+    const auto try_allocate{[&](pool& pl) -> bool {
+        if(auto vertex_offs{pl.vertices.allocate(entry.vertex_count)}) {
+            if(auto index_offs{pl.indices.allocate(entry.index_size)}) {
+                entry.base_vertex = vertex_offs.value_anyway();
+                entry.first_index = index_offs.value_anyway();
+                return true;
+            }
+            pl.vertices.release(vertex_offs.value_anyway(), entry.vertex_count);
+        }
+        return false;
+    }};
+
+    for(const auto p : index_range(_pools)) {
+        auto& pl{_pools[p]};
+        if((pl.stride == layout.stride) and (pl.format == format)) {
+            if(try_allocate(pl)) {
+                entry.pool = span_size(p);
+                break;
+            }
+        }
+    }
+    if(not entry.is_live()) {
+        if(
+          (entry.vertex_count > _vertex_capacity) or
+          (entry.index_size > _index_capacity)) {
+            return {};
+        }
+        entry.pool = _make_pool(glapi, std::move(format), layout.stride);
+        [[maybe_unused]] const bool allocated{
+          try_allocate(_pools[std_size(entry.pool)])};
+        assert(allocated);
+    }
+    const auto& pl{_pools[std_size(entry.pool)]};
+
+    const auto vertex_size{layout.data_size()};
+    auto block{cover(temp.ensure(vertex_size + layout.scratch_size))};
+    auto vertex_data{head(block, vertex_size)};
+    shape.interleaved_attrib_data(
+      bindings, layout, vertex_data, skip(block, vertex_size));
+    // the copy_write_buffer target does not disturb the bound vertex array
+    gl.bind_buffer(GL.copy_write_buffer, pl.vbo);
+    gl.buffer_sub_data(
+      GL.copy_write_buffer,
+      limit_cast<gl_types::intptr_type>(entry.base_vertex * pl.stride),
+      vertex_data);
+
+    if(indexed) {
+        auto index_data{head(cover(temp.ensure(index_size)), index_size)};
+        shape.index_data(var, index_data);
+        gl.bind_buffer(GL.copy_write_buffer, pl.ibo);
+        gl.buffer_sub_data(
+          GL.copy_write_buffer,
+          limit_cast<gl_types::intptr_type>(entry.first_index),
+          index_data);
+    }
+
+    entry.ops.resize(std_size(shape.operation_count(var)));
+    shape.instructions(glapi, var, cover(entry.ops));
+    for(auto& op : entry.ops) {
+        if(op.is_indexed(glapi)) {
+            op.offset_first(entry.first_index);
+        }
+    }
+
+    geometry_arena_handle result;
+    if(_free_slots.empty()) {
+        result.slot = span_size(_entries.size());
+        _entries.push_back(std::move(entry));
+    } else {
+        result.slot = _free_slots.back();
+        _free_slots.pop_back();
+        _entries[std_size(result.slot)] = std::move(entry);
+    }
+    return result;
+}
+//------------------------------------------------------------------------------
+void geometry_arena::remove(const geometry_arena_handle handle) noexcept {
+    if(not handle) {
+        return;
+    }
+    auto& entry{_entries[std_size(handle.slot)]};
+    if(not entry.is_live()) {
+        return;
+    }
+    auto& pl{_pools[std_size(entry.pool)]};
+    pl.vertices.release(entry.base_vertex, entry.vertex_count);
+    pl.indices.release(entry.first_index, entry.index_size);
+    entry = {};
+    _free_slots.push_back(handle.slot);
+}
+//------------------------------------------------------------------------------
+auto geometry_arena::compact(const gl_api& glapi) -> span_size_t {
+    const auto& [gl, GL] = glapi;
+    span_size_t moved{0};
+
+    for(const auto p : index_range(_pools)) {
+        auto& pl{_pools[p]};
+        if(not pl.vertices.has_gaps() and not pl.indices.has_gaps()) {
+            continue;
+        }
+
+        std::vector<geometry_arena_entry*> live;
+        for(auto& entry : _entries) {
+            if(entry.pool == span_size(p)) {
+                live.push_back(&entry);
+            }
+        }
+        std::sort(live.begin(), live.end(), [](auto* l, auto* r) {
+            return l->base_vertex < r->base_vertex;
+        });
+
+        // copy the live ranges into fresh buffers, the source and
+        // destination ranges could overlap within the same buffer
+        owned_buffer_name vbo;
+        owned_buffer_name ibo;
+        gl.gen_buffers() >> vbo;
+        gl.gen_buffers() >> ibo;
+
+        const auto vertex_size{pl.vertices.capacity() * pl.stride};
+        const auto index_size{pl.indices.capacity()};
+        gl.bind_buffer(GL.copy_write_buffer, vbo);
+        gl.buffer_data(
+          GL.copy_write_buffer,
+          memory::const_block{memory::typed_nullptr<const byte>, vertex_size},
+          GL.static_draw);
+        gl.bind_buffer(GL.copy_write_buffer, ibo);
+        gl.buffer_data(
+          GL.copy_write_buffer,
+          memory::const_block{memory::typed_nullptr<const byte>, index_size},
+          GL.static_draw);
+
+        const auto copy{[&](
+                          buffer_name src,
+                          buffer_name dst,
+                          span_size_t src_offs,
+                          span_size_t dst_offs,
+                          span_size_t size) {
+            if(size <= 0) {
+                return;
+            }
+            gl.bind_buffer(GL.copy_read_buffer, src);
+            gl.bind_buffer(GL.copy_write_buffer, dst);
+            gl.copy_buffer_sub_data(
+              GL.copy_read_buffer,
+              GL.copy_write_buffer,
+              limit_cast<gl_types::intptr_type>(src_offs),
+              limit_cast<gl_types::intptr_type>(dst_offs),
+              limit_cast<gl_types::sizeiptr_type>(size));
+        }};
+
+        span_size_t vertex_end{0};
+        span_size_t index_end{0};
+        for(auto* entry : live) {
+            if(
+              (entry->base_vertex != vertex_end) or
+              (entry->first_index != index_end)) {
+                ++moved;
+            }
+            copy(
+              pl.vbo,
+              vbo,
+              entry->base_vertex * pl.stride,
+              vertex_end * pl.stride,
+              entry->vertex_count * pl.stride);
+            copy(
+              pl.ibo, ibo, entry->first_index, index_end, entry->index_size);
+
+            for(auto& op : entry->ops) {
+                if(op.is_indexed(glapi)) {
+                    op.offset_first(index_end - entry->first_index);
+                }
+            }
+            entry->base_vertex = vertex_end;
+            entry->first_index = index_end;
+            vertex_end += entry->vertex_count;
+            index_end += pl.indices.aligned(entry->index_size);
+        }
+        pl.vertices.reset(vertex_end);
+        pl.indices.reset(index_end);
+
+        glapi.clean_up(std::move(pl.vbo));
+        glapi.clean_up(std::move(pl.ibo));
+        pl.vbo = std::move(vbo);
+        pl.ibo = std::move(ibo);
+        _setup_vao(glapi, pl);
+    }
+    return moved;
+}
+//------------------------------------------------------------------------------
+void geometry_arena::use(
+  const gl_api& glapi,
+  const geometry_arena_handle handle) const {
+    glapi.bind_vertex_array(_pools[std_size(entry(handle).pool)].vao);
+}
+//------------------------------------------------------------------------------
+void geometry_arena::draw(
+  const gl_api& glapi,
+  const geometry_arena_handle handle,
+  shape_draw_state& state) const {
+    const auto& e{entry(handle)};
+    const auto base_vertex{limit_cast<gl_types::int_type>(e.base_vertex)};
+    for(const auto& op : e.ops) {
+        op.draw_base_vertex(glapi, base_vertex, state);
+    }
+}
+//------------------------------------------------------------------------------
+void geometry_arena::draw(
+  const gl_api& glapi,
+  const span<const geometry_arena_handle> handles) const {
+    shape_draw_state state;
+    span_size_t current_pool{-1};
+    for(const auto handle : handles) {
+        if(not handle or not entry(handle).is_live()) [[unlikely]] {
+            continue;
+        }
+        if(const auto pool_idx{entry(handle).pool}; pool_idx != current_pool) {
+            use(glapi, handle);
+            current_pool = pool_idx;
+        }
+        draw(glapi, handle, state);
+    }
+}
+//------------------------------------------------------------------------------
+void geometry_arena::clean_up(const gl_api& glapi) {
+    for(auto& pl : _pools) {
+        glapi.clean_up(std::move(pl.ibo));
+        glapi.clean_up(std::move(pl.vbo));
+        glapi.clean_up(std::move(pl.vao));
+    }
+    _pools.clear();
+    _entries.clear();
+    _free_slots.clear();
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::oglplus
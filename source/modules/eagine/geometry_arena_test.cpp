@@ -0,0 +1,258 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+
+#include <eagine/testing/unit_begin_ctx.hpp>
+import std;
+import eagine.core;
+import eagine.shapes;
+import eagine.oglplus;
+//------------------------------------------------------------------------------
+void geometry_arena_allocate(auto& s) {
+    eagitest::case_ test{s, 1, "allocate"};
+    eagine::oglplus::buffer_range_allocator alloc{64, 4};
+
+    const auto a{alloc.allocate(10)};
+    const auto b{alloc.allocate(4)};
+    const auto c{alloc.allocate(1)};
+    test.check(a and b and c, "allocated");
+    test.check_equal(a.value_anyway(), 0, "a");
+    test.check_equal(b.value_anyway(), 12, "b aligned");
+    test.check_equal(c.value_anyway(), 16, "c");
+    test.check_equal(alloc.used(), 20, "used");
+    test.check(not alloc.allocate(48), "too big");
+    test.check(bool(alloc.allocate(44)), "fits");
+    test.check_equal(alloc.free_range_count(), 0, "full");
+}
+//------------------------------------------------------------------------------
+void geometry_arena_release(auto& s) {
+    eagitest::case_ test{s, 2, "release and merge"};
+    eagine::oglplus::buffer_range_allocator alloc{100, 1};
+
+    const auto a{alloc.allocate(10).value_anyway()};
+    const auto b{alloc.allocate(20).value_anyway()};
+    const auto c{alloc.allocate(30).value_anyway()};
+    test.check_equal(alloc.free_range_count(), 1, "one free");
+
+    alloc.release(a, 10);
+    alloc.release(c, 30);
+    test.check_equal(alloc.free_range_count(), 2, "fragmented");
+    test.check_equal(alloc.largest_free_range(), 70, "largest 1");
+
+    test.check(alloc.has_gaps(), "gap before b");
+    test.check_equal(alloc.high_water_mark(), 30, "high-water mark 1");
+
+    alloc.release(b, 20);
+    test.check_equal(alloc.free_range_count(), 1, "merged");
+    test.check(not alloc.has_gaps(), "no gaps");
+    test.check_equal(alloc.high_water_mark(), 0, "high-water mark 2");
+    test.check_equal(alloc.largest_free_range(), 100, "largest 2");
+    test.check_equal(alloc.used(), 0, "empty");
+}
+//------------------------------------------------------------------------------
+void geometry_arena_reuse(auto& s) {
+    eagitest::case_ test{s, 3, "reuse and reset"};
+    eagine::oglplus::buffer_range_allocator alloc{100, 1};
+
+    const auto a{alloc.allocate(40).value_anyway()};
+    alloc.allocate(40);
+    alloc.release(a, 40);
+    const auto b{alloc.allocate(30)};
+    test.check(bool(b), "reused");
+    test.check_equal(b.value_anyway(), 0, "first fit");
+
+    // a single gap in a full buffer still fragments it
+    alloc.allocate(20);
+    test.check_equal(alloc.free_range_count(), 1, "one gap");
+    test.check(alloc.has_gaps(), "full with a gap");
+    test.check_equal(alloc.high_water_mark(), 100, "high-water mark");
+
+    alloc.reset(70);
+    test.check_equal(alloc.used(), 70, "used");
+    test.check_equal(alloc.free_range_count(), 1, "compacted");
+    test.check_equal(alloc.largest_free_range(), 30, "tail");
+}
+//------------------------------------------------------------------------------
+void geometry_arena_add_remove(auto& s) {
+    eagitest::case_ test{s, 4, "add and remove shapes"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+
+    const vertex_attrib_bindings bindings{
+      shapes::vertex_attrib_kind::position, shapes::vertex_attrib_kind::normal};
+    const shape_generator cube{
+      glapi, shapes::unit_cube(bindings.attrib_kinds())};
+    memory::buffer temp;
+    geometry_arena arena{1024, 4096};
+
+    const auto a{arena.add(glapi, cube, bindings, temp)};
+    const auto b{arena.add(glapi, cube, bindings, temp)};
+    test.check(a and b, "added");
+    test.check_equal(arena.shape_count(), 2, "shape count");
+    test.check_equal(arena.pool_count(), 1, "same format, one pool");
+    test.check_equal(recorder.call_count("GenVertexArrays"), 1, "one vao");
+    // the pool storage is allocated once, the shapes are sub-data updates
+    test.check_equal(recorder.call_count("BufferData"), 2, "storage");
+    test.check(recorder.call_count("BufferSubData") >= 2, "shape data");
+
+    const auto& ea{arena.entry(a)};
+    const auto& eb{arena.entry(b)};
+    test.check(ea.is_live() and eb.is_live(), "live");
+    test.check(ea.vertex_count > 0, "vertices");
+    test.check_equal(ea.base_vertex, 0, "first base vertex");
+    test.check_equal(eb.base_vertex, ea.vertex_count, "second base vertex");
+    test.check(not ea.ops.empty(), "operations");
+
+    arena.remove(b);
+    test.check_equal(arena.shape_count(), 1, "removed");
+    test.check(not arena.entry(b).is_live(), "not live");
+    arena.remove(b);
+    test.check_equal(arena.shape_count(), 1, "removed once");
+
+    // the removed slot and buffer ranges are reused
+    const auto c{arena.add(glapi, cube, bindings, temp)};
+    test.check_equal(c.slot, b.slot, "slot reused");
+    test.check_equal(
+      arena.entry(c).base_vertex, ea.vertex_count, "range reused");
+
+    const shape_generator big{
+      glapi,
+      shapes::unit_twisted_torus(bindings.attrib_kinds(), 6, 48, 4, 0.5F)};
+    geometry_arena small{8, 64};
+    test.check(not small.add(glapi, big, bindings, temp), "too big");
+    test.check_equal(small.pool_count(), 0, "no pool");
+
+    arena.clean_up(glapi);
+    small.clean_up(glapi);
+    test.check_equal(
+      recorder.call_count("DeleteVertexArrays"), 1, "vao deleted");
+}
+//------------------------------------------------------------------------------
+void geometry_arena_compact(auto& s) {
+    eagitest::case_ test{s, 5, "compact"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+
+    const vertex_attrib_bindings bindings{
+      shapes::vertex_attrib_kind::position};
+    const shape_generator cube{
+      glapi, shapes::unit_cube(bindings.attrib_kinds())};
+    memory::buffer temp;
+    geometry_arena arena{1024, 4096};
+
+    const auto a{arena.add(glapi, cube, bindings, temp)};
+    const auto b{arena.add(glapi, cube, bindings, temp)};
+    const auto c{arena.add(glapi, cube, bindings, temp)};
+    const auto vertex_count{arena.entry(a).vertex_count};
+    const auto first_index{arena.entry(b).first_index};
+    test.check_equal(
+      arena.entry(c).base_vertex, 2 * vertex_count, "before compact");
+
+    // nothing to move without fragmentation
+    recorder.clear();
+    test.check_equal(arena.compact(glapi), 0, "not fragmented");
+    test.check_equal(recorder.call_count("GenBuffers"), 0, "no new buffers");
+
+    // the last shape is moved into the gap left by the removed one
+    arena.remove(b);
+    recorder.clear();
+    test.check_equal(arena.compact(glapi), 1, "moved");
+    test.check_equal(
+      arena.entry(c).base_vertex, vertex_count, "moved base vertex");
+    test.check_equal(
+      arena.entry(c).first_index, first_index, "moved first index");
+    test.check_equal(arena.entry(a).base_vertex, 0, "not moved");
+    test.check_equal(recorder.call_count("GenBuffers"), 2, "new buffers");
+    test.check_equal(recorder.call_count("BufferData"), 2, "new storage");
+    test.check(recorder.call_count("CopyBufferSubData") >= 2, "copied");
+    test.check_equal(recorder.call_count("DeleteBuffers"), 2, "old deleted");
+
+    arena.remove(a);
+    test.check_equal(arena.compact(glapi), 1, "moved again");
+    test.check_equal(arena.entry(c).base_vertex, 0, "at the beginning");
+    test.check_equal(arena.entry(c).first_index, 0, "first index");
+
+    const auto d{arena.add(glapi, cube, bindings, temp)};
+    test.check_equal(
+      arena.entry(d).base_vertex, vertex_count, "after compacted range");
+
+    // removing the last shape leaves no gaps below the high-water mark
+    arena.remove(d);
+    recorder.clear();
+    test.check_equal(arena.compact(glapi), 0, "only the tail is free");
+    test.check_equal(recorder.call_count("GenBuffers"), 0, "still no buffers");
+    arena.clean_up(glapi);
+}
+//------------------------------------------------------------------------------
+void geometry_arena_draw(auto& s) {
+    eagitest::case_ test{s, 6, "draw"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+
+    const vertex_attrib_bindings bindings{
+      shapes::vertex_attrib_kind::position};
+    const vertex_attrib_bindings other_bindings{
+      shapes::vertex_attrib_kind::position, shapes::vertex_attrib_kind::normal};
+    const shape_generator cube{
+      glapi, shapes::unit_cube(bindings.attrib_kinds())};
+    const shape_generator other_cube{
+      glapi, shapes::unit_cube(other_bindings.attrib_kinds())};
+    memory::buffer temp;
+    geometry_arena arena{1024, 4096};
+
+    const std::array<geometry_arena_handle, 4> handles{
+      arena.add(glapi, cube, bindings, temp),
+      arena.add(glapi, cube, bindings, temp),
+      geometry_arena_handle{},
+      arena.add(glapi, other_cube, other_bindings, temp)};
+    test.check_equal(arena.pool_count(), 2, "two pools");
+
+    span_size_t op_count{0};
+    for(const auto handle : handles) {
+        if(handle) {
+            op_count += span_size(arena.entry(handle).ops.size());
+        }
+    }
+
+    recorder.clear();
+    arena.draw(glapi, view(handles));
+    test.check_equal(
+      recorder.call_count("BindVertexArray"), 2, "one bind per pool");
+    test.check_equal(
+      recorder.call_count("DrawElementsBaseVertex") +
+        recorder.call_count("DrawArrays"),
+      op_count,
+      "draw calls");
+    test.check_equal(
+      recorder.call_count("DrawElementsInstancedBaseVertex") +
+        recorder.call_count("DrawArraysInstanced"),
+      0,
+      "not instanced");
+    arena.clean_up(glapi);
+}
+//------------------------------------------------------------------------------
+auto test_main(eagine::test_ctx& ctx) -> int {
+    eagitest::ctx_suite test{ctx, "geometry_arena", 6};
+    test.once(geometry_arena_allocate);
+    test.once(geometry_arena_release);
+    test.once(geometry_arena_reuse);
+    test.once(geometry_arena_add_remove);
+    test.once(geometry_arena_compact);
+    test.once(geometry_arena_draw);
+    return test.exit_code();
+}
+//------------------------------------------------------------------------------
+#include <eagine/testing/unit_end_ctx.hpp>
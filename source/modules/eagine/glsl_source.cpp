@@ -219,6 +219,67 @@ private:
 
 using glsl_string = glsl_container<std::string>;
 //------------------------------------------------------------------------------
+/// @brief Class referencing a pre-compiled SPIR-V shader module.
+/// @ingroup glsl_utils
+/// @see glsl_source_ref
+///
+/// Besides the binary module, this references the name of the entry point
+/// and the indices and values of the specialization constants which are
+/// passed to the GL when the shader is specialized.
+export class spir_v_source_ref {
+public:
+    /// @brief Alias for unsigned integer type.
+    using uint_type = gl_types::uint_type;
+
+    /// @brief Construction from the binary module and entry point name.
+    /// @pre entry_point is null-terminated
+    constexpr spir_v_source_ref(
+      const memory::const_block binary,
+      const string_view entry_point = "main") noexcept
+      : _binary{binary}
+      , _entry_point{entry_point} {}
+
+    /// @brief Sets the indices and values of specialization constants.
+    /// @pre indices.size() == values.size()
+    constexpr auto specialize(
+      const span<const uint_type> indices,
+      const span<const uint_type> values) noexcept -> spir_v_source_ref& {
+        assert(indices.size() == values.size());
+        _constant_indices = indices;
+        _constant_values = values;
+        return *this;
+    }
+
+    /// @brief Returns the binary SPIR-V module.
+    constexpr auto binary() const noexcept -> memory::const_block {
+        return _binary;
+    }
+
+    /// @brief Returns the name of the entry point of the shader.
+    constexpr auto entry_point() const noexcept -> string_view {
+        return _entry_point;
+    }
+
+    /// @brief Returns the indices of the specialization constants.
+    /// @see constant_values
+    constexpr auto constant_indices() const noexcept
+      -> span<const uint_type> {
+        return _constant_indices;
+    }
+
+    /// @brief Returns the values of the specialization constants.
+    /// @see constant_indices
+    constexpr auto constant_values() const noexcept -> span<const uint_type> {
+        return _constant_values;
+    }
+
+private:
+    memory::const_block _binary;
+    string_view _entry_point;
+    span<const uint_type> _constant_indices;
+    span<const uint_type> _constant_values;
+};
+//------------------------------------------------------------------------------
 } // namespace eagine::oglplus
 
 namespace eagine::c_api {
@@ -10,12 +10,14 @@ import std;
 import eagine.core.types;
 import eagine.core.memory;
 import eagine.core.valid_if;
+import eagine.core.resource;
 import eagine.shapes;
 import :config;
 import :enum_types;
 import :objects;
 import :glsl_source;
 import :prog_var_loc;
+import :type_utils;
 import :shapes;
 import :api;
 
@@ -57,6 +59,436 @@ private:
     shapes::vertex_attrib_map<std::string> _mapping;
 };
 //------------------------------------------------------------------------------
+/// @brief The type and source of a shader of a program built through a cache.
+/// @ingroup gl_api_wrap
+/// @see program_binary_cache
+export struct program_shader_source {
+    /// @brief The type of the shader.
+    shader_type type;
+    /// @brief The GLSL source of the shader.
+    glsl_source_ref source;
+};
+//------------------------------------------------------------------------------
+/// @brief Counters of a program_binary_cache.
+/// @ingroup gl_api_wrap
+/// @see program_binary_cache
+export struct program_binary_cache_stats {
+    /// @brief The number of programs loaded from a stored binary.
+    span_size_t hit_count{0};
+    /// @brief The number of programs without a stored binary.
+    span_size_t miss_count{0};
+    /// @brief The number of stored binaries rejected by the driver.
+    span_size_t rejected_count{0};
+    /// @brief The number of binaries stored after compiling from source.
+    span_size_t stored_count{0};
+};
+//------------------------------------------------------------------------------
+/// @brief Cache of linked GL program binaries stored in a directory.
+/// @ingroup gl_api_wrap
+/// @see gpu_program
+///
+/// The entries are keyed by a hash of the types and sources of all shaders
+/// of a program, of the GL vendor, renderer and version strings and of the
+/// program binary format of the driver. Each entry is stored in a separate
+/// file, together with the binary format it was retrieved in. Entries that
+/// the driver refuses to load are removed and the program is built from
+/// the shader sources instead.
+export class program_binary_cache {
+public:
+    /// @brief Construction with the directory where the entries are stored.
+    explicit program_binary_cache(std::filesystem::path directory) noexcept
+      : _directory{std::move(directory)} {}
+
+    /// @brief Returns the directory where the entries are stored.
+    auto directory() const noexcept -> const std::filesystem::path& {
+        return _directory;
+    }
+
+    /// @brief Returns the key of a program built from the specified shaders.
+    ///
+    /// The key also depends on the GL implementation and on the program
+    /// binary formats it supports.
+    auto key_of(
+      const gl_api& glapi,
+      const span<const program_shader_source> shaders) const
+      -> std::uint64_t;
+
+    /// @brief Loads the binary stored under the specified key into a program.
+    /// @see store
+    ///
+    /// Returns false if there is no such entry, or if the driver rejected
+    /// the stored binary. In the latter case the entry is removed.
+    auto load(const gl_api& glapi, program_name prog, std::uint64_t key)
+      -> bool;
+
+    /// @brief Stores the binary of a linked program under the specified key.
+    /// @see load
+    auto store(const gl_api& glapi, program_name prog, std::uint64_t key)
+      -> bool;
+
+    /// @brief Links a program, from the stored binary if possible.
+    ///
+    /// If there is no usable stored binary, the shaders are compiled and
+    /// attached to the program, the program is linked and its binary is
+    /// stored for the next time.
+    auto build(
+      const gl_api& glapi,
+      program_name prog,
+      const span<const program_shader_source> shaders) -> bool;
+
+    /// @brief Returns the cache counters.
+    auto stats() const noexcept -> const program_binary_cache_stats& {
+        return _stats;
+    }
+
+private:
+    auto _entry_path(std::uint64_t key) const -> std::filesystem::path;
+
+    std::filesystem::path _directory;
+    program_binary_cache_stats _stats;
+};
+//------------------------------------------------------------------------------
+/// @brief Information about a shader or program that failed to build.
+/// @ingroup gl_api_wrap
+/// @see shader_compile_batch
+export struct shader_build_failure {
+    /// @brief The program that the failed shader belongs to, or that failed.
+    program_name program;
+    /// @brief The type of the failed shader, empty if linking failed.
+    std::optional<shader_type> type;
+    /// @brief The shader compiler or program linker info log.
+    std::string log;
+};
+//------------------------------------------------------------------------------
+/// @brief Set of shaders and programs compiled and linked without waiting.
+/// @ingroup gl_api_wrap
+/// @see gpu_program
+///
+/// The shaders are compiled and the programs are linked as they are added,
+/// but their status is not queried until finish. If the driver supports
+/// KHR_parallel_shader_compile (or ARB_parallel_shader_compile), it builds
+/// them on its own threads and is_done can be polled without blocking,
+/// for example while loading other resources. Otherwise is_done always
+/// returns true and finish blocks until the driver is done. The info logs
+/// are only fetched for the shaders and programs that failed to build.
+export class shader_compile_batch {
+public:
+    /// @brief Default constructor.
+    shader_compile_batch() noexcept = default;
+
+    shader_compile_batch(shader_compile_batch&&) noexcept = default;
+    shader_compile_batch(const shader_compile_batch&) = delete;
+    auto operator=(shader_compile_batch&&) noexcept
+      -> shader_compile_batch& = default;
+    auto operator=(const shader_compile_batch&) = delete;
+    ~shader_compile_batch() noexcept = default;
+
+    /// @brief Compiles a shader and attaches it to the specified program.
+    /// @see link
+    auto add_shader(
+      const gl_api& glapi,
+      program_name prog,
+      shader_type shdr_type,
+      const glsl_source_ref& shdr_src,
+      const string_view label = {}) -> shader_compile_batch&;
+
+    /// @brief Links the program, after all its shaders were added.
+    auto link(const gl_api& glapi, program_name prog)
+      -> shader_compile_batch&;
+
+    /// @brief Returns the number of shaders and programs not finished yet.
+    auto pending_count() const noexcept -> span_size_t {
+        return span_size(_shaders.size() + _programs.size());
+    }
+
+    /// @brief Indicates if the driver is done with all shaders and programs.
+    /// @see finish
+    auto is_done(const gl_api& glapi) -> bool;
+
+    /// @brief Waits until all shaders and programs are built.
+    /// @see failures
+    ///
+    /// Returns true if all of them were built successfully. The shader
+    /// objects are released, the programs keep them until deleted.
+    auto finish(const gl_api& glapi) -> bool;
+
+    /// @brief Returns the information about the failed shaders and programs.
+    auto failures() const noexcept -> const std::vector<shader_build_failure>& {
+        return _failures;
+    }
+
+    /// @brief Releases the shader objects of an unfinished batch.
+    void clean_up(const gl_api& glapi) noexcept;
+
+private:
+    struct shader_entry {
+        owned_shader_name shader;
+        program_name program;
+        shader_type type;
+    };
+
+    auto _is_complete(const gl_api& glapi, shader_name shdr) const noexcept
+      -> bool;
+    auto _is_complete(const gl_api& glapi, program_name prog) const noexcept
+      -> bool;
+
+    std::vector<shader_entry> _shaders;
+    std::vector<program_name> _programs;
+    std::vector<shader_build_failure> _failures;
+    std::optional<bool> _parallel;
+};
+//------------------------------------------------------------------------------
+/// @brief Hashed name of an active uniform, vertex attribute or uniform block.
+/// @ingroup gl_api_wrap
+/// @see program_reflection
+///
+/// Names specified as string literals are hashed at compile time. Uniform
+/// arrays are reported by GL under the name of their first element,
+/// for example "Lights[0]".
+export class program_resource_id {
+public:
+    /// @brief Default constructor, constructs an empty id.
+    constexpr program_resource_id() noexcept = default;
+
+    /// @brief Construction from a string literal.
+    template <std::size_t L>
+    constexpr program_resource_id(const char (&name)[L]) noexcept
+      : _hash{_hash_of(name, L - 1U)} {}
+
+    /// @brief Construction from a resource name string.
+    constexpr program_resource_id(const string_view name) noexcept
+      : _hash{_hash_of(name.data(), std_size(name.size()))} {}
+
+    /// @brief Returns the hash of the resource name.
+    constexpr auto hash() const noexcept -> std::uint64_t {
+        return _hash;
+    }
+
+    /// @brief Indicates if this id is not empty.
+    explicit constexpr operator bool() const noexcept {
+        return _hash != 0U;
+    }
+
+    /// @brief Equality comparison.
+    friend constexpr auto operator==(
+      const program_resource_id,
+      const program_resource_id) noexcept -> bool = default;
+
+private:
+    static constexpr auto _hash_of(const char* str, std::size_t len) noexcept
+      -> std::uint64_t {
+        std::uint64_t hash{0xCBF29CE484222325U};
+        for(std::size_t i = 0U; i < len; ++i) {
+            hash ^= static_cast<std::uint8_t>(str[i]);
+            hash *= 0x100000001B3U;
+        }
+        // zero is reserved for the empty id
+        return hash != 0U ? hash : 1U;
+    }
+
+    std::uint64_t _hash{0U};
+};
+//------------------------------------------------------------------------------
+/// @brief Kinds of active program resources stored by program_reflection.
+/// @ingroup gl_api_wrap
+export enum class program_resource_kind : std::uint8_t {
+    /// @brief Default block uniform.
+    uniform,
+    /// @brief Vertex attribute (program input).
+    vertex_attrib,
+    /// @brief Uniform block.
+    uniform_block
+};
+//------------------------------------------------------------------------------
+/// @brief Information about an active program resource.
+/// @ingroup gl_api_wrap
+/// @see program_reflection
+export struct program_resource_info {
+    /// @brief The hashed resource name.
+    program_resource_id id{};
+    /// @brief The kind of the resource.
+    program_resource_kind kind{program_resource_kind::uniform};
+    /// @brief The GL type of a uniform or attribute, zero for blocks.
+    gl_types::enum_type type{0U};
+    /// @brief The location of a uniform or attribute, or the block index.
+    gl_types::int_type location{-1};
+    /// @brief The number of array elements, one for non-arrays.
+    gl_types::int_type array_size{0};
+
+    /// @brief Indicates if this is information about an active resource.
+    explicit constexpr operator bool() const noexcept {
+        return location >= 0;
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Uniform location typed by the value type used to set the uniform.
+/// @ingroup gl_api_wrap
+/// @see program_reflection
+/// @see gpu_program
+///
+/// Besides the location, the handle carries the GL type of the uniform
+/// reported by the program (for example FLOAT_VEC4). The type is checked
+/// against T when the handle is looked up, so uniforms declared with
+/// a different type in the shader get an inactive handle.
+export template <typename T>
+class uniform_handle {
+public:
+    /// @brief Indicates if uniforms with the specified GL type are set from T.
+    /// @see uniform_type_of
+    ///
+    /// Types without a single matching GL type are not checked. Integer
+    /// handles also match the sampler and image uniforms, which are set
+    /// to the index of a texture or image unit.
+    static constexpr auto is_compatible(const gl_types::enum_type type) noexcept
+      -> bool {
+        constexpr const auto expected{uniform_type_of<T>()};
+        if constexpr(std::is_same_v<T, gl_types::int_type>) {
+            if(is_sampler_or_image_type(type)) {
+                return true;
+            }
+        }
+        return (expected == 0U) or (type == expected);
+    }
+
+    /// @brief Default constructor, constructs an inactive handle.
+    constexpr uniform_handle() noexcept = default;
+
+    /// @brief Construction from the location and the GL type of a uniform.
+    constexpr uniform_handle(
+      const uniform_location loc,
+      const gl_types::enum_type type) noexcept
+      : _location{loc}
+      , _type{type} {}
+
+    /// @brief Returns the location of the uniform.
+    constexpr auto location() const noexcept -> uniform_location {
+        return _location;
+    }
+
+    /// @brief Returns the GL type of the uniform.
+    constexpr auto gl_type() const noexcept -> gl_types::enum_type {
+        return _type;
+    }
+
+    /// @brief Indicates if this handle refers to an active uniform.
+    explicit constexpr operator bool() const noexcept {
+        return _location.location() >= 0;
+    }
+
+private:
+    uniform_location _location{};
+    gl_types::enum_type _type{0U};
+};
+//------------------------------------------------------------------------------
+/// @brief Table of the active uniforms, attributes and blocks of a program.
+/// @ingroup gl_api_wrap
+/// @see gpu_program
+///
+/// The table is filled once by reflect after the program is linked and
+/// is stored as a flat open-addressed hash table keyed by the hashed
+/// resource names, so finding a resource takes constant time and does
+/// not involve any GL calls or string comparisons.
+export class program_reflection {
+public:
+    /// @brief Enumerates the active resources of a linked program.
+    ///
+    /// Returns false if the program interface queries are not supported
+    /// by the GL implementation. Waits for the linking to finish.
+    auto reflect(const gl_api& glapi, program_name prog) -> bool;
+
+    /// @brief Returns the number of stored resources.
+    auto count() const noexcept -> span_size_t {
+        return _count;
+    }
+
+    /// @brief Indicates if there are no resources stored.
+    auto is_empty() const noexcept -> bool {
+        return _count == 0;
+    }
+
+    /// @brief Finds the resource of the specified kind with the specified id.
+    /// @post not result if not found
+    auto find(
+      const program_resource_id id,
+      const program_resource_kind kind) const noexcept
+      -> program_resource_info {
+        if(not _slots.empty()) {
+            const auto mask{_slots.size() - 1U};
+            for(auto pos{_slot_of(id, kind) & mask};;
+                pos = (pos + 1U) & mask) {
+                const auto& slot{_slots[pos]};
+                if(not slot.id) {
+                    break;
+                }
+                if((slot.id == id) and (slot.kind == kind)) {
+                    return slot;
+                }
+            }
+        }
+        return {};
+    }
+
+    /// @brief Returns the location of the uniform with the specified id.
+    auto uniform(const program_resource_id id) const noexcept
+      -> uniform_location {
+        return uniform_location{
+          find(id, program_resource_kind::uniform).location};
+    }
+
+    /// @brief Returns a typed handle of the uniform with the specified id.
+    /// @post not result if not found or if the uniform type does not match T.
+    template <typename T>
+    auto uniform_handle_of(const program_resource_id id) const noexcept
+      -> uniform_handle<T> {
+        const auto info{find(id, program_resource_kind::uniform)};
+        if(not uniform_handle<T>::is_compatible(info.type)) {
+            return {};
+        }
+        return {uniform_location{info.location}, info.type};
+    }
+
+    /// @brief Returns the location of the vertex attribute with the given id.
+    auto vertex_attrib(const program_resource_id id) const noexcept
+      -> vertex_attrib_location {
+        return vertex_attrib_location{
+          find(id, program_resource_kind::vertex_attrib).location};
+    }
+
+    /// @brief Returns the index of the uniform block with the specified id.
+    auto uniform_block(const program_resource_id id) const noexcept
+      -> uniform_block_index {
+        return uniform_block_index{
+          find(id, program_resource_kind::uniform_block).location};
+    }
+
+    /// @brief Removes all stored resources.
+    void clear() noexcept {
+        _slots.clear();
+        _count = 0;
+    }
+
+private:
+    static constexpr auto _slot_of(
+      const program_resource_id id,
+      const program_resource_kind kind) noexcept -> std::size_t {
+        return std::size_t(
+          id.hash() ^
+          (std::uint64_t(kind) * std::uint64_t(0x9E3779B97F4A7C15U)));
+    }
+
+    auto _collect(
+      const gl_api& glapi,
+      program_name prog,
+      program_interface intf,
+      program_resource_kind kind,
+      std::vector<program_resource_info>& found) const -> bool;
+
+    void _insert(const program_resource_info& info) noexcept;
+
+    std::vector<program_resource_info> _slots;
+    span_size_t _count{0};
+};
+//------------------------------------------------------------------------------
 export class gpu_program : public owned_program_name {
     using base = owned_program_name;
 
@@ -88,16 +520,87 @@ public:
         return *this;
     }
 
+    auto add_spir_v_shader(
+      const gl_api& glapi,
+      shader_type shdr_type,
+      const spir_v_source_ref& shdr_src) -> gpu_program& {
+        glapi.add_spir_v_shader(*this, shdr_type, shdr_src);
+        return *this;
+    }
+
+    auto add_spir_v_shader(
+      const gl_api& glapi,
+      shader_type shdr_type,
+      const spir_v_source_ref& shdr_src,
+      const string_view label) -> gpu_program& {
+        glapi.add_spir_v_shader(*this, shdr_type, shdr_src, label);
+        return *this;
+    }
+
+    auto add_spir_v_shader(
+      const gl_api& glapi,
+      shader_type shdr_type,
+      const embedded_resource& shdr_res) -> gpu_program& {
+        glapi.add_spir_v_shader(*this, shdr_type, shdr_res);
+        return *this;
+    }
+
     auto link(const gl_api& glapi) -> gpu_program& {
         glapi.link_program(*this);
         return *this;
     }
 
+    auto add_shader(
+      const gl_api& glapi,
+      shader_compile_batch& batch,
+      shader_type shdr_type,
+      const glsl_source_ref& shdr_src) -> gpu_program& {
+        batch.add_shader(glapi, *this, shdr_type, shdr_src);
+        return *this;
+    }
+
+    auto link(const gl_api& glapi, shader_compile_batch& batch)
+      -> gpu_program& {
+        batch.link(glapi, *this);
+        return *this;
+    }
+
+    /// @brief Adds the shaders and links, or loads the binary from a cache.
+    /// @see program_binary_cache::build
+    ///
+    /// Returns false if the program could not be built.
+    auto build(
+      const gl_api& glapi,
+      program_binary_cache& cache,
+      const span<const program_shader_source> shaders) -> bool {
+        return cache.build(glapi, *this, shaders);
+    }
+
     auto use(const gl_api& glapi) -> gpu_program& {
         glapi.use_program(*this);
         return *this;
     }
 
+    /// @brief Fills the reflection table of the linked program.
+    /// @see reflection
+    auto reflect(const gl_api& glapi) -> gpu_program& {
+        _reflection.reflect(glapi, *this);
+        return *this;
+    }
+
+    /// @brief Returns the reflection table filled by reflect.
+    auto reflection() const noexcept -> const program_reflection& {
+        return _reflection;
+    }
+
+    /// @brief Returns a typed handle of the uniform with the specified id.
+    /// @pre reflect was called after the program was linked.
+    template <typename T>
+    auto uniform(const program_resource_id id) const noexcept
+      -> uniform_handle<T> {
+        return _reflection.uniform_handle_of<T>(id);
+    }
+
     auto get_uniform_location(const gl_api& glapi, string_view name) -> auto {
         return glapi.get_uniform_location(*this, name);
     }
@@ -126,6 +629,16 @@ public:
         return *this;
     }
 
+    /// @brief Sets the uniform, if the handle type is compatible with T.
+    template <typename T>
+    auto set(const gl_api& glapi, uniform_handle<T> handle, const T& value)
+      -> gpu_program& {
+        if(handle and handle.is_compatible(handle.gl_type())) {
+            glapi.set_uniform(*this, handle.location(), value);
+        }
+        return *this;
+    }
+
     auto bind(const gl_api& glapi, vertex_attrib_location loc, string_view name)
       -> gpu_program& {
         glapi.bind_attrib_location(*this, loc, name);
@@ -142,8 +655,12 @@ public:
 
     auto clean_up(const gl_api& glapi) -> gpu_program& {
         glapi.clean_up(static_cast<base&&>(*this));
+        _reflection.clear();
         return *this;
     }
+
+private:
+    program_reflection _reflection;
 };
 //------------------------------------------------------------------------------
 } // namespace eagine::oglplus
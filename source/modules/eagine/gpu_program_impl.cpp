@@ -60,4 +60,361 @@ auto program_input_bindings::clear() noexcept -> program_input_bindings& {
     return *this;
 }
 //------------------------------------------------------------------------------
+// shader_compile_batch
+//------------------------------------------------------------------------------
+auto shader_compile_batch::add_shader(
+  const gl_api& glapi,
+  program_name prog,
+  shader_type shdr_type,
+  const glsl_source_ref& shdr_src,
+  const string_view label) -> shader_compile_batch& {
+    owned_shader_name shdr;
+    glapi.create_shader(shdr_type) >> shdr;
+    if(not label.empty()) {
+        glapi.object_label(shdr, label);
+    }
+    glapi.shader_source(shdr, shdr_src);
+    glapi.compile_shader(shdr);
+    // the program keeps the shader alive until it is deleted
+    glapi.attach_shader(prog, shdr);
+    _shaders.push_back({std::move(shdr), prog, shdr_type});
+    return *this;
+}
+//------------------------------------------------------------------------------
+auto shader_compile_batch::link(const gl_api& glapi, program_name prog)
+  -> shader_compile_batch& {
+    glapi.link_program(prog);
+    _programs.push_back(prog);
+    return *this;
+}
+//------------------------------------------------------------------------------
+auto shader_compile_batch::_is_complete(
+  const gl_api& glapi,
+  shader_name shdr) const noexcept -> bool {
+    const auto& [gl, GL] = glapi;
+    return gl.get_shader_i(shdr, GL.completion_status)
+      .transform([](auto status) { return bool(status); })
+      .value_or(true);
+}
+//------------------------------------------------------------------------------
+auto shader_compile_batch::_is_complete(
+  const gl_api& glapi,
+  program_name prog) const noexcept -> bool {
+    const auto& [gl, GL] = glapi;
+    return gl.get_program_i(prog, GL.completion_status)
+      .transform([](auto status) { return bool(status); })
+      .value_or(true);
+}
+//------------------------------------------------------------------------------
+auto shader_compile_batch::is_done(const gl_api& glapi) -> bool {
+    if(not _parallel) {
+        _parallel = glapi.has_extension("KHR_parallel_shader_compile") or
+                    glapi.has_extension("ARB_parallel_shader_compile");
+    }
+    if(not *_parallel) {
+        // any status query would block until the driver is done
+        return true;
+    }
+    return std::all_of(
+             _shaders.begin(),
+             _shaders.end(),
+             [&](const auto& entry) {
+                 return _is_complete(glapi, entry.shader);
+             }) and
+           std::all_of(
+             _programs.begin(), _programs.end(), [&](const auto prog) {
+                 return _is_complete(glapi, prog);
+             });
+}
+//------------------------------------------------------------------------------
+auto shader_compile_batch::finish(const gl_api& glapi) -> bool {
+    for(auto& entry : _shaders) {
+        if(not glapi.is_shader_compiled(entry.shader)) {
+            auto log{glapi.shader_info_log(entry.shader)};
+            _failures.push_back(
+              {.program = entry.program,
+               .type = entry.type,
+               .log = std::move(log).value_or(std::string{})});
+        }
+        glapi.clean_up(std::move(entry.shader));
+    }
+    _shaders.clear();
+    for(const auto prog : _programs) {
+        if(not glapi.is_program_linked(prog)) {
+            _failures.push_back(
+              {.program = prog,
+               .type = {},
+               .log = glapi.program_info_log(prog).value_or(std::string{})});
+        }
+    }
+    _programs.clear();
+    return _failures.empty();
+}
+//------------------------------------------------------------------------------
+void shader_compile_batch::clean_up(const gl_api& glapi) noexcept {
+    for(auto& entry : _shaders) {
+        glapi.clean_up(std::move(entry.shader));
+    }
+    _shaders.clear();
+    _programs.clear();
+}
+//------------------------------------------------------------------------------
+// program_binary_cache
+//------------------------------------------------------------------------------
+auto program_binary_hash(std::uint64_t hash, memory::const_block blk) noexcept
+  -> std::uint64_t {
+    // FNV-1a, the keys must not change between runs
+    for(const auto b : blk) {
+        hash ^= std::uint64_t(b);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+//------------------------------------------------------------------------------
+auto program_binary_hash(std::uint64_t hash, string_view str) noexcept
+  -> std::uint64_t {
+    return program_binary_hash(hash, as_bytes(str));
+}
+//------------------------------------------------------------------------------
+struct program_binary_header {
+    std::uint32_t magic{0x4F474C42U};
+    std::uint32_t format{0U};
+};
+//------------------------------------------------------------------------------
+auto program_binary_cache::key_of(
+  const gl_api& glapi,
+  const span<const program_shader_source> shaders) const
+  -> std::uint64_t {
+    const auto& [gl, GL] = glapi;
+    std::uint64_t key{14695981039346656037ULL};
+    key = program_binary_hash(key, gl.get_vendor().value_or(string_view{}));
+    key = program_binary_hash(key, gl.get_renderer().value_or(string_view{}));
+    key = program_binary_hash(key, gl.get_version().value_or(string_view{}));
+    const auto format_count{
+      gl.get_integer(GL.num_program_binary_formats).value_or(0)};
+    key = program_binary_hash(key, as_bytes(view_one(format_count)));
+    if(format_count > 0) {
+        std::vector<gl_types::int_type> formats(std_size(format_count));
+        gl.get_integer(GL.program_binary_formats, cover(formats));
+        key = program_binary_hash(key, as_bytes(view(formats)));
+    }
+
+    for(const auto& shader : shaders) {
+        const auto type{gl_types::enum_type(shader.type)};
+        key = program_binary_hash(key, as_bytes(view_one(type)));
+        const auto& src{shader.source};
+        for(gl_types::sizei_type i = 0; i < src.count(); ++i) {
+            const auto part{src.parts()[i]};
+            const auto length{src.lengths() ? src.lengths()[i] : -1};
+            key = program_binary_hash(
+              key,
+              length < 0 ? string_view{part}
+                         : string_view{part, span_size(length)});
+        }
+    }
+    return key;
+}
+//------------------------------------------------------------------------------
+auto program_binary_cache::_entry_path(std::uint64_t key) const
+  -> std::filesystem::path {
+    return _directory / std::format("{:016x}.glprog", key);
+}
+//------------------------------------------------------------------------------
+auto program_binary_cache::load(
+  const gl_api& glapi,
+  program_name prog,
+  std::uint64_t key) -> bool {
+    const auto path{_entry_path(key)};
+    std::ifstream file{path, std::ios::binary};
+    program_binary_header header{};
+    const auto magic{header.magic};
+    if(
+      not file.read(reinterpret_cast<char*>(&header), sizeof(header)) or
+      (header.magic != magic)) {
+        ++_stats.miss_count;
+        return false;
+    }
+    const std::vector<char> binary{
+      std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    file.close();
+
+    const auto& gl{glapi.operations()};
+    if(
+      gl.program_binary(
+        prog,
+        program_binary_format{gl_types::enum_type(header.format)},
+        as_bytes(view(binary))) and
+      glapi.is_program_linked(prog)) {
+        ++_stats.hit_count;
+        return true;
+    }
+    // the driver was updated or does not accept its own binaries
+    std::error_code error;
+    std::filesystem::remove(path, error);
+    ++_stats.rejected_count;
+    return false;
+}
+//------------------------------------------------------------------------------
+auto program_binary_cache::store(
+  const gl_api& glapi,
+  program_name prog,
+  std::uint64_t key) -> bool {
+    const auto& [gl, GL] = glapi;
+    const auto length{gl.get_program_i(prog, GL.program_binary_length)};
+    if(not length or (*length <= 0)) {
+        return false;
+    }
+    std::vector<byte> binary(std_size(*length));
+    gl_types::enum_type format{0};
+    const auto data{gl.get_program_binary(prog, &format, cover(binary))};
+    if(not data or data->empty()) {
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(_directory, error);
+    const auto path{_entry_path(key)};
+    auto temp_path{path};
+    temp_path += ".tmp";
+    {
+        std::ofstream file{temp_path, std::ios::binary};
+        program_binary_header header{};
+        header.format = std::uint32_t(format);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(
+          reinterpret_cast<const char*>(data->data()),
+          std::streamsize(data->size()));
+        if(not file) {
+            file.close();
+            std::filesystem::remove(temp_path, error);
+            return false;
+        }
+    }
+    // concurrently running instances do not see incomplete entries
+    std::filesystem::rename(temp_path, path, error);
+    if(error) {
+        std::filesystem::remove(temp_path, error);
+        return false;
+    }
+    ++_stats.stored_count;
+    return true;
+}
+//------------------------------------------------------------------------------
+auto program_binary_cache::build(
+  const gl_api& glapi,
+  program_name prog,
+  const span<const program_shader_source> shaders) -> bool {
+    const auto key{key_of(glapi, shaders)};
+    if(load(glapi, prog, key)) {
+        return true;
+    }
+    for(const auto& shader : shaders) {
+        if(not glapi.add_shader(prog, shader.type, shader.source)) {
+            return false;
+        }
+    }
+    // without the hint the binary may not be retrievable after linking
+    const auto& [gl, GL] = glapi;
+    gl.program_parameter_i(prog, GL.program_binary_retrievable_hint, GL.true_);
+    gl.link_program(prog);
+    if(not glapi.is_program_linked(prog)) {
+        return false;
+    }
+    store(glapi, prog, key);
+    return true;
+}
+//------------------------------------------------------------------------------
+auto program_reflection::_collect(
+  const gl_api& glapi,
+  program_name prog,
+  program_interface intf,
+  program_resource_kind kind,
+  std::vector<program_resource_info>& found) const -> bool {
+    const auto& [gl, GL] = glapi;
+    const auto count{
+      gl.get_program_interface_i(prog, intf, GL.active_resources)};
+    if(not count) {
+        return false;
+    }
+    const auto max_length{
+      gl.get_program_interface_i(prog, intf, GL.max_name_length).value_or(0)};
+    std::vector<char> name(std_size(max_length) + 1U);
+
+    for(const auto index : integer_range(*count)) {
+        const auto uindex{limit_cast<gl_types::uint_type>(index)};
+        const auto str{
+          gl.get_program_resource_name(prog, intf, uindex, cover(name))};
+        if(not str) {
+            continue;
+        }
+        program_resource_info info{};
+        info.id = program_resource_id{string_view{str->data(), str->size()}};
+        info.kind = kind;
+        if(kind == program_resource_kind::uniform_block) {
+            info.location = limit_cast<gl_types::int_type>(index);
+            info.array_size = 1;
+        } else {
+            glapi.get_program_variable_info(
+              prog, intf, uindex, info.type, info.location, info.array_size);
+            // uniforms in blocks and built-in inputs have no location
+            if(info.location < 0) {
+                continue;
+            }
+        }
+        found.push_back(info);
+    }
+    return true;
+}
+//------------------------------------------------------------------------------
+void program_reflection::_insert(const program_resource_info& info) noexcept {
+    const auto mask{_slots.size() - 1U};
+    for(auto pos{_slot_of(info.id, info.kind) & mask};;
+        pos = (pos + 1U) & mask) {
+        auto& slot{_slots[pos]};
+        if(not slot.id) {
+            slot = info;
+            ++_count;
+            return;
+        }
+        if((slot.id == info.id) and (slot.kind == info.kind)) {
+            return;
+        }
+    }
+}
+//------------------------------------------------------------------------------
+auto program_reflection::reflect(const gl_api& glapi, program_name prog)
+  -> bool {
+    const auto& GL{glapi.constants()};
+    std::vector<program_resource_info> found;
+    const bool supported{
+      _collect(
+        glapi, prog, GL.uniform, program_resource_kind::uniform, found) and
+      _collect(
+        glapi,
+        prog,
+        GL.program_input,
+        program_resource_kind::vertex_attrib,
+        found) and
+      _collect(
+        glapi,
+        prog,
+        GL.uniform_block,
+        program_resource_kind::uniform_block,
+        found)};
+
+    clear();
+    if(not found.empty()) {
+        // keeps the table at most half full, so that the probes stay short
+        std::size_t capacity{8U};
+        while(capacity < found.size() * 2U) {
+            capacity *= 2U;
+        }
+        _slots.resize(capacity);
+        for(const auto& info : found) {
+            _insert(info);
+        }
+    }
+    return supported;
+}
+//------------------------------------------------------------------------------
 } // namespace eagine::oglplus
@@ -19,11 +19,17 @@ export import :result;
 export import :objects;
 export import :prog_var_loc;
 export import :c_api;
+export import :function_names;
+export import :recording;
 export import :api_traits;
 export import :constants;
 export import :api;
+export import :state_tracker;
 export import :gl_debug_logger;
 export import :gpu_program;
 export import :framebuffer;
 export import :shapes;
+export import :geometry_arena;
+export import :buffer_ring;
 export import :resources;
+export import :uniform_block;
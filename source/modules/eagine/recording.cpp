@@ -0,0 +1,553 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.oglplus:recording;
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.valid_if;
+import :config;
+import :c_api;
+import :api_traits;
+
+namespace eagine::oglplus {
+//------------------------------------------------------------------------------
+/// @brief Numeric identifier of a GL function recorded by gl_command_recorder.
+/// @ingroup gl_api_wrap
+export using gl_command_id = std::uint16_t;
+//------------------------------------------------------------------------------
+/// @brief Records GL calls made through the recording stub functions.
+/// @ingroup gl_api_wrap
+/// @see recording_gl_api_traits
+///
+/// The calls are stored in a compact binary command stream, consisting
+/// of the command id, the byte size of the arguments and the raw argument
+/// values (pointers are recorded as addresses, not as the pointed-to data).
+/// Functions generating or creating GL objects get unique object names,
+/// queries and other functions returning values return zero (or null) or
+/// the value set with set_result or set_pointer_result. Values or strings
+/// added with add_output are written by the following calls, one entry
+/// per call. Stubs forward the calls to the current recorder of the calling
+/// thread, there can be only one current recorder per thread at a time.
+export class gl_command_recorder {
+public:
+    /// @brief Default constructor.
+    gl_command_recorder() noexcept = default;
+
+    gl_command_recorder(gl_command_recorder&&) = delete;
+    gl_command_recorder(const gl_command_recorder&) = delete;
+    auto operator=(gl_command_recorder&&) = delete;
+    auto operator=(const gl_command_recorder&) = delete;
+
+    ~gl_command_recorder() noexcept {
+        if(_current == this) {
+            _current = nullptr;
+        }
+    }
+
+    /// @brief Makes this the recorder receiving calls from the current thread.
+    /// @throws std::logic_error if another recorder is current in the thread.
+    ///
+    /// The stubs are shared by all recorders, so the calls of another live
+    /// recorder would be misrouted to this one.
+    void make_current() {
+        if(_current and (_current != this)) [[unlikely]] {
+            throw std::logic_error(
+              "another GL command recorder is already current in this thread");
+        }
+        _current = this;
+    }
+
+    /// @brief Returns the recorder receiving calls from the current thread.
+    static auto current() noexcept -> gl_command_recorder* {
+        return _current;
+    }
+
+    /// @brief Returns the id of the GL function with the specified name.
+    /// @see command_name
+    ///
+    /// The name is specified without the gl prefix, for example "BindBuffer".
+    static auto command_id(const string_view name) noexcept
+      -> optionally_valid<gl_command_id>;
+
+    /// @brief Returns the name of the GL function with the specified id.
+    /// @see command_id
+    static auto command_name(const gl_command_id id) noexcept -> string_view;
+
+    /// @brief Sets the value returned by (or written by) the named function.
+    ///
+    /// For functions with pointer output parameters, like GetIntegerv,
+    /// the value is written into the first output element.
+    auto set_result(const string_view name, const std::int64_t value)
+      -> gl_command_recorder&;
+
+    /// @brief Sets the pointer returned by the named function.
+    ///
+    /// This is used for functions like MapBufferRange or FenceSync.
+    auto set_pointer_result(const string_view name, const void* value)
+      -> gl_command_recorder&;
+
+    /// @brief Adds the values written by the next call of the named function.
+    /// @see set_result
+    ///
+    /// The values are written into the last output array parameter, for
+    /// example the params of GetProgramResourceiv, the other output
+    /// parameters, like the length, get the number of the written values.
+    /// Each call of the function uses the next added entry, calls without
+    /// entries get the value set with set_result.
+    auto add_output(
+      const string_view name,
+      const span<const std::int64_t> values) -> gl_command_recorder&;
+
+    /// @brief Adds the string written by the next call of the named function.
+    /// @see set_result
+    ///
+    /// This is used for functions like GetProgramResourceName, the other
+    /// output parameters get the length of the string.
+    auto add_output(const string_view name, const string_view str)
+      -> gl_command_recorder&;
+
+    /// @brief Returns the total number of recorded calls.
+    auto call_count() const noexcept -> span_size_t {
+        return _call_count;
+    }
+
+    /// @brief Returns the number of recorded calls of the named function.
+    auto call_count(const string_view name) const noexcept -> span_size_t;
+
+    /// @brief Returns the number of object names generated so far.
+    auto generated_name_count() const noexcept -> span_size_t {
+        return span_size(_next_name - 1U);
+    }
+
+    /// @brief Returns the recorded binary command stream.
+    auto stream() const noexcept -> memory::const_block {
+        return view(_stream);
+    }
+
+    /// @brief Calls the specified function for each command in the stream.
+    ///
+    /// The function gets the command id and a block with the raw arguments.
+    template <typename Function>
+    void for_each_command(Function func) const {
+        std::size_t pos{0U};
+        while(pos + _header_size <= _stream.size()) {
+            gl_command_id id{};
+            std::uint16_t size{};
+            std::memcpy(&id, _stream.data() + pos, sizeof(id));
+            std::memcpy(
+              &size, _stream.data() + pos + sizeof(id), sizeof(size));
+            pos += _header_size;
+            func(id, memory::const_block{_stream.data() + pos, size});
+            pos += size;
+        }
+    }
+
+    /// @brief Clears the recorded commands and call counters.
+    ///
+    /// Configured results and the object name counter are kept.
+    void clear() noexcept {
+        _stream.clear();
+        _call_counts.clear();
+        _call_count = 0;
+    }
+
+    /// @brief Records a call, returns the configured or generated result.
+    /// @note This is used by the recording stubs.
+    template <typename R, typename... P>
+    auto invoke(const gl_command_id id, P... args) -> R;
+
+    /// @brief Returns the id of the named function, registering it if needed.
+    static auto register_command(const string_view name) -> gl_command_id;
+
+private:
+    static constexpr const std::size_t _header_size{
+      sizeof(gl_command_id) + sizeof(std::uint16_t)};
+
+    struct command_info {
+        std::string name;
+        bool generates_names{false};
+        bool is_query{false};
+    };
+
+    struct call_output {
+        std::vector<std::int64_t> values;
+        std::string chars;
+
+        auto size() const noexcept -> std::size_t {
+            return chars.empty() ? values.size() : chars.size();
+        }
+    };
+
+    auto _output_queue(const string_view name) -> std::deque<call_output>&;
+
+    // pointers to non-const arithmetic values are output parameters
+    template <typename T>
+    static constexpr const bool _is_output =
+      std::is_pointer_v<T> and
+      std::is_arithmetic_v<std::remove_pointer_t<T>> and
+      not std::is_const_v<std::remove_pointer_t<T>>;
+
+    template <typename... P>
+    static constexpr auto _last_output_index() noexcept -> std::size_t {
+        std::size_t result{sizeof...(P)};
+        std::size_t index{0U};
+        ((result = _is_output<P> ? index : result, ++index), ...);
+        return result;
+    }
+
+    struct registry {
+        std::vector<command_info> commands;
+        std::map<std::string, gl_command_id, std::less<>> ids;
+    };
+
+    static auto _registry() noexcept -> registry&;
+
+    template <typename T>
+    void _append(const T& value) noexcept {
+        const auto pos{_stream.size()};
+        _stream.resize(pos + sizeof(T));
+        std::memcpy(_stream.data() + pos, &value, sizeof(T));
+    }
+
+    template <typename T>
+    void _handle_output(
+      const command_info& info,
+      const std::optional<std::int64_t>& result,
+      const call_output* output,
+      const bool is_last,
+      gl_types::sizei_type& count,
+      T arg) noexcept {
+        if constexpr(std::is_same_v<T, gl_types::sizei_type>) {
+            count = arg;
+        } else if constexpr(_is_output<T>) {
+            using U = std::remove_pointer_t<T>;
+            if(arg == nullptr) {
+                return;
+            }
+            if(info.generates_names) {
+                if constexpr(std::is_same_v<U, gl_types::uint_type>) {
+                    for(gl_types::sizei_type i = 0; i < count; ++i) {
+                        arg[i] = _next_name++;
+                    }
+                }
+            } else if(output) {
+                if(is_last) {
+                    _write_output(*output, count, arg);
+                } else {
+                    *arg = static_cast<U>(output->size());
+                }
+            } else if(info.is_query) {
+                *arg = static_cast<U>(result.value_or(0));
+            }
+        }
+    }
+
+    template <typename U>
+    static void _write_output(
+      const call_output& output,
+      const gl_types::sizei_type count,
+      U* dest) noexcept {
+        const auto capacity{std::size_t(std::max(count, 0))};
+        if constexpr(std::is_same_v<U, gl_types::char_type>) {
+            if(not output.chars.empty()) {
+                if(capacity > 0U) {
+                    // leaves room for the terminating zero
+                    const auto size{
+                      std::min(output.chars.size(), capacity - 1U)};
+                    std::copy_n(output.chars.data(), size, dest);
+                    dest[size] = '\0';
+                }
+                return;
+            }
+        }
+        const auto size{std::min(output.values.size(), capacity)};
+        for(std::size_t i = 0U; i < size; ++i) {
+            dest[i] = static_cast<U>(output.values[i]);
+        }
+    }
+
+    static inline thread_local gl_command_recorder* _current{nullptr};
+
+    std::vector<byte> _stream;
+    std::vector<span_size_t> _call_counts;
+    std::vector<std::optional<std::int64_t>> _results;
+    std::vector<std::deque<call_output>> _outputs;
+    span_size_t _call_count{0};
+    gl_types::uint_type _next_name{1U};
+};
+//------------------------------------------------------------------------------
+inline auto gl_command_recorder::_registry() noexcept -> registry& {
+    static registry reg;
+    return reg;
+}
+//------------------------------------------------------------------------------
+inline auto gl_command_recorder::register_command(const string_view name)
+  -> gl_command_id {
+    auto& reg{_registry()};
+    const std::string_view str{name.data(), std_size(name.size())};
+    if(const auto pos{reg.ids.find(str)}; pos != reg.ids.end()) {
+        return pos->second;
+    }
+    const auto id{static_cast<gl_command_id>(reg.commands.size())};
+    reg.commands.push_back(
+      {.name = std::string{str},
+       .generates_names =
+         (str.starts_with("Gen") and not str.starts_with("Generate")) or
+         str.starts_with("Create"),
+       .is_query = str.starts_with("Get")});
+    reg.ids.emplace(std::string{str}, id);
+    return id;
+}
+//------------------------------------------------------------------------------
+inline auto gl_command_recorder::command_id(const string_view name) noexcept
+  -> optionally_valid<gl_command_id> {
+    const auto& reg{_registry()};
+    const std::string_view str{name.data(), std_size(name.size())};
+    if(const auto pos{reg.ids.find(str)}; pos != reg.ids.end()) {
+        return {pos->second, true};
+    }
+    return {};
+}
+//------------------------------------------------------------------------------
+inline auto gl_command_recorder::command_name(const gl_command_id id) noexcept
+  -> string_view {
+    const auto& reg{_registry()};
+    if(std_size(id) < reg.commands.size()) {
+        return string_view{reg.commands[std_size(id)].name};
+    }
+    return {};
+}
+//------------------------------------------------------------------------------
+inline auto gl_command_recorder::set_result(
+  const string_view name,
+  const std::int64_t value) -> gl_command_recorder& {
+    const auto id{std_size(register_command(name))};
+    if(_results.size() <= id) {
+        _results.resize(id + 1U);
+    }
+    _results[id] = value;
+    return *this;
+}
+//------------------------------------------------------------------------------
+inline auto gl_command_recorder::set_pointer_result(
+  const string_view name,
+  const void* value) -> gl_command_recorder& {
+    return set_result(
+      name, static_cast<std::int64_t>(reinterpret_cast<std::intptr_t>(value)));
+}
+//------------------------------------------------------------------------------
+inline auto gl_command_recorder::_output_queue(const string_view name)
+  -> std::deque<call_output>& {
+    const auto id{std_size(register_command(name))};
+    if(_outputs.size() <= id) {
+        _outputs.resize(id + 1U);
+    }
+    return _outputs[id];
+}
+//------------------------------------------------------------------------------
+inline auto gl_command_recorder::add_output(
+  const string_view name,
+  const span<const std::int64_t> values) -> gl_command_recorder& {
+    _output_queue(name).push_back(
+      {.values = {values.begin(), values.end()}, .chars = {}});
+    return *this;
+}
+//------------------------------------------------------------------------------
+inline auto gl_command_recorder::add_output(
+  const string_view name,
+  const string_view str) -> gl_command_recorder& {
+    _output_queue(name).push_back(
+      {.values = {}, .chars = std::string{str.data(), std_size(str.size())}});
+    return *this;
+}
+//------------------------------------------------------------------------------
+inline auto gl_command_recorder::call_count(const string_view name)
+  const noexcept -> span_size_t {
+    if(const auto id{command_id(name)}) {
+        const auto idx{std_size(id.value_anyway())};
+        if(idx < _call_counts.size()) {
+            return _call_counts[idx];
+        }
+    }
+    return 0;
+}
+//------------------------------------------------------------------------------
+template <typename R, typename... P>
+auto gl_command_recorder::invoke(const gl_command_id id, P... args) -> R {
+    const auto idx{std_size(id)};
+    if(_call_counts.size() <= idx) {
+        _call_counts.resize(idx + 1U, 0);
+    }
+    ++_call_counts[idx];
+    ++_call_count;
+
+    _append(id);
+    _append(static_cast<std::uint16_t>((0U + ... + sizeof(P))));
+    (_append(args), ...);
+
+    const auto& info{_registry().commands[idx]};
+    const std::optional<std::int64_t> result{
+      idx < _results.size() ? _results[idx] : std::nullopt};
+
+    std::optional<call_output> output;
+    if((idx < _outputs.size()) and not _outputs[idx].empty()) {
+        output = std::move(_outputs[idx].front());
+        _outputs[idx].pop_front();
+    }
+
+    gl_types::sizei_type count{1};
+    constexpr const auto last{_last_output_index<P...>()};
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (_handle_output(
+           info,
+           result,
+           output ? &*output : nullptr,
+           I == last,
+           count,
+           args),
+         ...);
+    }(std::index_sequence_for<P...>{});
+
+    if constexpr(std::is_arithmetic_v<R>) {
+        if(info.generates_names) {
+            if constexpr(std::is_same_v<R, gl_types::uint_type>) {
+                return _next_name++;
+            }
+        }
+        return static_cast<R>(result.value_or(0));
+    } else if constexpr(std::is_pointer_v<R>) {
+        return reinterpret_cast<R>(
+          static_cast<std::intptr_t>(result.value_or(0)));
+    } else if constexpr(not std::is_void_v<R>) {
+        return R{};
+    }
+}
+//------------------------------------------------------------------------------
+// Each GL function linked to a recording stub needs a distinct function
+// pointer, so that functions with the same signature can be told apart.
+// The functions are linked only by name and signature, so there is nothing
+// a plain function pointer could be keyed by at compile time. Instead the
+// stubs for a signature are a fixed pool of slots, each bound at run time
+// to the id of one GL function. GLenum, GLuint and GLbitfield are the same
+// C type, so many GL functions share a signature. The most shared ones in
+// the wrapped API are void(GLuint, GLuint) with 38 functions, void(GLuint)
+// with 35 and void(GLuint, GLuint, GLint*) with 25. The pool size leaves
+// room for future additions, and linking more functions than there are
+// slots throws, instead of leaving the extra functions unavailable.
+template <typename Signature>
+struct gl_recording_stubs;
+
+template <typename R, typename... P>
+struct gl_recording_stubs<R(P...)> {
+    static auto link(const gl_command_id id) -> R (*)(P...) {
+        for(std::size_t i = 0U; i < _used; ++i) {
+            if(_ids[i] == id) {
+                return _slot(i, std::make_index_sequence<_slot_count>{});
+            }
+        }
+        if(_used < _slot_count) [[likely]] {
+            _ids[_used] = id;
+            return _slot(_used++, std::make_index_sequence<_slot_count>{});
+        }
+        throw std::length_error(
+          "too many GL functions with the same signature for the recording "
+          "stubs, the slot count needs to be increased");
+    }
+
+private:
+    static constexpr const std::size_t _slot_count{64U};
+
+    template <std::size_t I>
+    static auto _call(P... args) noexcept -> R {
+        if(auto recorder{gl_command_recorder::current()}) {
+            return recorder->template invoke<R>(_ids[I], args...);
+        }
+        if constexpr(not std::is_void_v<R>) {
+            return R{};
+        }
+    }
+
+    template <std::size_t... I>
+    static auto _slot(const std::size_t i, std::index_sequence<I...>) noexcept
+      -> R (*)(P...) {
+        static constexpr const std::array<R (*)(P...), sizeof...(I)> slots{
+          &_call<I>...};
+        return slots[i];
+    }
+
+    static inline std::array<gl_command_id, _slot_count> _ids{};
+    static inline std::size_t _used{0U};
+};
+//------------------------------------------------------------------------------
+/// @brief Returns a recording stub for the named GL function.
+/// @ingroup gl_api_wrap
+/// @see gl_command_recorder
+/// @throws std::length_error if there are no free stubs for the Signature.
+export template <typename Signature>
+auto link_recording_stub(const string_view name)
+  -> std::add_pointer_t<Signature> {
+    return gl_recording_stubs<Signature>::link(
+      gl_command_recorder::register_command(name));
+}
+//------------------------------------------------------------------------------
+// Traits used only to instantiate the C-API wrapper once, linking every
+// function to its recording stub and collecting the stubs by name, because
+// the sliced gl_api_traits can resolve the functions only by their name.
+class gl_recording_linker : public gl_api_traits {
+public:
+    template <typename Api, typename Tag, typename Signature>
+    auto link_function(
+      Api&,
+      Tag,
+      string_view name,
+      std::type_identity<Signature>) -> std::add_pointer_t<Signature> {
+        auto func{link_recording_stub<Signature>(name)};
+        stubs.emplace(
+          std::string{name.data(), std_size(name.size())},
+          reinterpret_cast<void*>(func));
+        return func;
+    }
+
+    std::map<std::string, void*, std::less<>> stubs;
+};
+//------------------------------------------------------------------------------
+/// @brief GL API traits linking every function to an in-process recording stub.
+/// @ingroup gl_api_wrap
+/// @see gl_command_recorder
+///
+/// Allows to run GL code without a GL context, for example in unit tests
+/// and in CPU-side benchmarks. This class adds no state to gl_api_traits,
+/// so it can also be used to initialize the default gl_api.
+export class recording_gl_api_traits : public gl_api_traits {
+public:
+    /// @brief Construction with a reference to the recorder of the calls.
+    /// @throws std::logic_error if another recorder is current in the thread.
+    explicit recording_gl_api_traits(gl_command_recorder& recorder)
+      : gl_api_traits{&_resolve} {
+        recorder.make_current();
+    }
+
+private:
+    static auto _resolve(const string_view name) -> void*;
+};
+//------------------------------------------------------------------------------
+inline auto recording_gl_api_traits::_resolve(const string_view name)
+  -> void* {
+    static const auto stubs{[] {
+        gl_recording_linker linker;
+        const basic_gl_c_api<gl_recording_linker> api{linker};
+        return std::move(linker.stubs);
+    }()};
+    const std::string_view str{name.data(), std_size(name.size())};
+    if(const auto pos{stubs.find(str)}; pos != stubs.end()) {
+        return pos->second;
+    }
+    return nullptr;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::oglplus
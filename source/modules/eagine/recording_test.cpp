@@ -0,0 +1,630 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+
+#include <eagine/testing/unit_begin_ctx.hpp>
+import std;
+import eagine.core;
+import eagine.shapes;
+import eagine.oglplus;
+//------------------------------------------------------------------------------
+void recording_generated_names(auto& s) {
+    eagitest::case_ test{s, 1, "generated names"};
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& gl{glapi.operations()};
+
+    owned_buffer_name buf1;
+    owned_buffer_name buf2;
+    gl.gen_buffers() >> buf1;
+    gl.gen_buffers() >> buf2;
+
+    test.check(bool(buf1), "buffer 1");
+    test.check(bool(buf2), "buffer 2");
+    test.check(buf1 != buf2, "distinct");
+    test.check_equal(recorder.generated_name_count(), 2, "name count");
+    test.check_equal(recorder.call_count("GenBuffers"), 2, "call count");
+
+    glapi.clean_up(std::move(buf1));
+    glapi.clean_up(std::move(buf2));
+    test.check_equal(recorder.call_count("DeleteBuffers"), 2, "deleted");
+}
+//------------------------------------------------------------------------------
+void recording_command_stream(auto& s) {
+    eagitest::case_ test{s, 2, "command stream"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& [gl, GL] = glapi;
+    recorder.clear();
+
+    gl.bind_buffer(GL.array_buffer, buffer_name{1U});
+    gl.enable(GL.depth_test);
+    gl.bind_buffer(GL.array_buffer, buffer_name{2U});
+    gl.disable(GL.depth_test);
+
+    span_size_t count{0};
+    span_size_t bind_buffer{0};
+    recorder.for_each_command(
+      [&](const gl_command_id id, const memory::const_block args) {
+          const auto name{gl_command_recorder::command_name(id)};
+          if(name == string_view{"BindBuffer"}) {
+              test.check_equal(
+                args.size(),
+                span_size(
+                  sizeof(gl_types::enum_type) + sizeof(gl_types::uint_type)),
+                "bind buffer args");
+              ++bind_buffer;
+          }
+          ++count;
+      });
+
+    test.check_equal(count, recorder.call_count(), "count");
+    test.check_equal(bind_buffer, 2, "bind buffer");
+    test.check_equal(recorder.call_count("Enable"), 1, "enable");
+    test.check_equal(recorder.call_count("Disable"), 1, "disable");
+    test.check(recorder.stream().size() > 0, "non-empty stream");
+}
+//------------------------------------------------------------------------------
+void recording_configured_results(auto& s) {
+    eagitest::case_ test{s, 3, "configured results"};
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& [gl, GL] = glapi;
+
+    recorder.set_result("GetIntegerv", 42);
+    test.check_equal(
+      gl.get_integer(GL.major_version).value_or(0), 42, "integer");
+
+    recorder.set_result("GetIntegerv", 7);
+    test.check_equal(
+      gl.get_integer(GL.major_version).value_or(0), 7, "changed");
+}
+//------------------------------------------------------------------------------
+void recording_program_input_bindings(auto& s) {
+    eagitest::case_ test{s, 4, "program input bindings"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+
+    const vertex_attrib_bindings bindings{
+      shapes::vertex_attrib_kind::position, shapes::vertex_attrib_kind::normal};
+    program_input_bindings inputs;
+    inputs.add("Position", shapes::vertex_attrib_kind::position);
+    inputs.add("Normal", shapes::vertex_attrib_kind::normal);
+
+    recorder.clear();
+    test.check(inputs.apply(glapi, program_name{1U}, bindings), "applied");
+    test.check_equal(recorder.call_count("UseProgram"), 1, "use program");
+    test.check_equal(
+      recorder.call_count("BindAttribLocation"), 2, "bind attrib location");
+    test.check_equal(recorder.call_count("LinkProgram"), 1, "link program");
+}
+//------------------------------------------------------------------------------
+void recording_offscreen_framebuffer(auto& s) {
+    eagitest::case_ test{s, 5, "offscreen framebuffer"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+
+    framebuffer_configuration config{glapi};
+    config.add_color_texture(GL.rgba, GL.rgba8).add_depth_buffer();
+    const std::array<gl_types::enum_type, 1> units{0};
+
+    offscreen_framebuffer fbo;
+    fbo.init(glapi, 256, 256, config, view(units));
+
+    test.check(bool(fbo), "initialized");
+    test.check_equal(recorder.call_count("GenFramebuffers"), 1, "fbo");
+    test.check_equal(recorder.call_count("GenTextures"), 1, "textures");
+    test.check_equal(recorder.call_count("GenRenderbuffers"), 1, "rbos");
+    test.check_equal(recorder.call_count("BindFramebuffer"), 2, "binds");
+
+    fbo.clean_up(glapi);
+}
+//------------------------------------------------------------------------------
+void recording_geometry_time(auto& s) {
+    eagitest::case_ test{s, 6, "geometry construction time"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+
+    const vertex_attrib_bindings bindings{
+      shapes::vertex_attrib_kind::position,
+      shapes::vertex_attrib_kind::normal,
+      shapes::vertex_attrib_kind::wrap_coord};
+    const shape_generator shape{
+      glapi, shapes::unit_twisted_torus(bindings.attrib_kinds(), 6, 48, 4, 0.5F)};
+
+    const span_size_t repeats{32};
+    memory::buffer temp;
+    recorder.clear();
+
+    const auto start{std::chrono::steady_clock::now()};
+    for(const auto r : integer_range(repeats)) {
+        (void)r;
+        geometry geom{glapi, shape, bindings, temp};
+        geom.use(glapi);
+        geom.draw(glapi);
+        geom.clean_up(glapi);
+    }
+    const std::chrono::duration<float, std::micro> elapsed{
+      std::chrono::steady_clock::now() - start};
+
+    s.context()
+      .log()
+      .info("geometry construction time")
+      .arg("repeats", repeats)
+      .arg("callsPerGeom", recorder.call_count() / repeats)
+      .arg("streamSize", recorder.stream().size())
+      .arg("perGeom", elapsed.count() / float(repeats));
+
+    test.check_equal(
+      recorder.call_count("GenVertexArrays"), repeats, "vertex arrays");
+    test.check_equal(
+      recorder.call_count("DeleteVertexArrays"), repeats, "deleted");
+}
+//------------------------------------------------------------------------------
+void recording_program_binary_cache(auto& s) {
+    eagitest::case_ test{s, 7, "program binary cache"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+
+    const std::array<program_shader_source, 2> shaders{
+      {{GL.vertex_shader, "void main() {}"},
+       {GL.fragment_shader, "void main() {}"}}};
+    const auto other{glsl_string_ref{string_view{"void main() { }"}}};
+    const std::array<program_shader_source, 2> changed{
+      {{GL.vertex_shader, "void main() {}"}, {GL.fragment_shader, other}}};
+
+    const auto directory{
+      std::filesystem::temp_directory_path() /
+      std::format(
+        "oglplus-test-progbin-{:x}",
+        std::chrono::steady_clock::now().time_since_epoch().count())};
+    program_binary_cache cache{directory};
+    test.check(
+      cache.key_of(glapi, view(shaders)) == cache.key_of(glapi, view(shaders)),
+      "same key");
+    test.check(
+      cache.key_of(glapi, view(shaders)) != cache.key_of(glapi, view(changed)),
+      "different key");
+
+    // the recorded programs never get linked, so nothing gets stored
+    recorder.clear();
+    test.check(
+      not cache.build(glapi, program_name{1U}, view(shaders)), "not linked");
+    test.check_equal(cache.stats().miss_count, 1, "miss");
+    test.check_equal(cache.stats().stored_count, 0, "not stored");
+    test.check_equal(recorder.call_count("CompileShader"), 2, "compiled");
+    test.check_equal(recorder.call_count("LinkProgram"), 1, "linked");
+    test.check_equal(recorder.call_count("ProgramBinary"), 0, "no binary");
+
+    // the retrievable hint is set before the program is linked
+    const auto hint_id{
+      gl_command_recorder::command_id("ProgramParameteri").value_or(0)};
+    const auto link_id{
+      gl_command_recorder::command_id("LinkProgram").value_or(0)};
+    int hint_pos{-1};
+    int link_pos{-1};
+    int pos{0};
+    recorder.for_each_command([&](gl_command_id id, memory::const_block) {
+        if(id == hint_id) {
+            hint_pos = pos;
+        } else if(id == link_id) {
+            link_pos = pos;
+        }
+        ++pos;
+    });
+    test.check(hint_pos >= 0, "hint set");
+    test.check(hint_pos < link_pos, "hint before link");
+
+    // all supported binary formats are queried for the key
+    recorder.clear();
+    recorder.set_result("GetIntegerv", 3);
+    const auto key{cache.key_of(glapi, view(shaders))};
+    test.check_equal(recorder.call_count("GetIntegerv"), 2, "format queries");
+    recorder.set_result("GetIntegerv", 2);
+    test.check(key != cache.key_of(glapi, view(shaders)), "format count");
+    recorder.set_result("GetIntegerv", 0);
+
+    // linked programs have a one-byte binary in the format added below
+    recorder.clear();
+    recorder.set_result("GetProgramiv", 1);
+    const std::array<std::int64_t, 1> format{0x1234};
+    recorder.add_output("GetProgramBinary", view(format));
+    gpu_program prog;
+    prog.create(glapi);
+    test.check(prog.build(glapi, cache, view(shaders)), "stored built");
+    test.check_equal(cache.stats().miss_count, 2, "stored miss");
+    test.check_equal(cache.stats().stored_count, 1, "stored");
+    test.check_equal(
+      recorder.call_count("GetProgramBinary"), 1, "binary retrieved");
+    test.check(not std::filesystem::is_empty(directory), "entry exists");
+
+    // the stored binary is loaded instead of compiling the shaders
+    recorder.clear();
+    test.check(prog.build(glapi, cache, view(shaders)), "hit built");
+    test.check_equal(cache.stats().hit_count, 1, "hit");
+    test.check_equal(recorder.call_count("ProgramBinary"), 1, "loaded");
+    test.check_equal(recorder.call_count("CompileShader"), 0, "not compiled");
+    test.check_equal(recorder.call_count("LinkProgram"), 0, "not linked");
+    const auto binary_id{
+      gl_command_recorder::command_id("ProgramBinary").value_or(0)};
+    recorder.for_each_command([&](gl_command_id id, memory::const_block args) {
+        if(id == binary_id) {
+            // program, format, binary pointer, length
+            gl_types::enum_type loaded_format{0};
+            gl_types::sizei_type length{0};
+            std::memcpy(&loaded_format, args.data() + 4, sizeof(loaded_format));
+            std::memcpy(&length, args.data() + 16, sizeof(length));
+            test.check_equal(loaded_format, 0x1234U, "binary format");
+            test.check_equal(length, 1, "binary length");
+        }
+    });
+
+    // the driver rejects the binary, the entry is removed and the program
+    // is built from the sources
+    recorder.clear();
+    recorder.set_result("GetProgramiv", 0);
+    test.check(not prog.build(glapi, cache, view(shaders)), "rejected");
+    test.check_equal(cache.stats().rejected_count, 1, "rejected count");
+    test.check_equal(recorder.call_count("ProgramBinary"), 1, "binary tried");
+    test.check_equal(recorder.call_count("CompileShader"), 2, "fallback");
+    test.check_equal(recorder.call_count("LinkProgram"), 1, "relinked");
+    test.check(std::filesystem::is_empty(directory), "entry removed");
+    prog.clean_up(glapi);
+
+    std::error_code error;
+    std::filesystem::remove_all(directory, error);
+    test.check(not error, "directory removed");
+}
+//------------------------------------------------------------------------------
+void recording_shader_compile_batch(auto& s) {
+    eagitest::case_ test{s, 8, "shader compile batch"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+
+    recorder.clear();
+    shader_compile_batch batch;
+    batch.add_shader(glapi, program_name{1U}, GL.vertex_shader, "void main(){}")
+      .add_shader(glapi, program_name{1U}, GL.fragment_shader, "void main(){}")
+      .link(glapi, program_name{1U});
+    test.check_equal(batch.pending_count(), 3, "pending");
+    test.check_equal(recorder.call_count("CompileShader"), 2, "compiled");
+    test.check_equal(recorder.call_count("LinkProgram"), 1, "linked");
+    test.check_equal(recorder.call_count("GetShaderiv"), 0, "no status");
+
+    // the recording stubs report no extensions and failed compilation
+    test.check(batch.is_done(glapi), "done");
+    test.check_equal(recorder.call_count("GetShaderiv"), 0, "not polled");
+    test.check(not batch.finish(glapi), "failed");
+    test.check_equal(batch.failures().size(), 3U, "failures");
+    test.check_equal(batch.pending_count(), 0, "finished");
+    test.check_equal(recorder.call_count("DeleteShader"), 2, "released");
+
+    // with parallel compilation the completion status is polled
+    const char* extension{"GL_KHR_parallel_shader_compile"};
+    recorder.set_result("GetIntegerv", 1)
+      .set_pointer_result("GetStringi", extension)
+      .set_result("GetShaderiv", 0)
+      .set_result("GetProgramiv", 0);
+    recorder.clear();
+    shader_compile_batch parallel;
+    parallel
+      .add_shader(glapi, program_name{2U}, GL.vertex_shader, "void main(){}")
+      .add_shader(glapi, program_name{2U}, GL.fragment_shader, "void main(){}")
+      .link(glapi, program_name{2U});
+    test.check(not parallel.is_done(glapi), "not done");
+    test.check_equal(recorder.call_count("GetShaderiv"), 1, "polled shader");
+    test.check_equal(recorder.call_count("GetProgramiv"), 0, "not polled");
+
+    recorder.set_result("GetShaderiv", 1).set_result("GetProgramiv", 1);
+    test.check(parallel.is_done(glapi), "parallel done");
+    test.check_equal(recorder.call_count("GetShaderiv"), 3, "polled shaders");
+    test.check_equal(recorder.call_count("GetProgramiv"), 1, "polled program");
+    test.check_equal(recorder.call_count("GetShaderInfoLog"), 0, "no log");
+    test.check_equal(recorder.call_count("GetProgramInfoLog"), 0, "no logs");
+    test.check_equal(parallel.pending_count(), 3, "still pending");
+
+    test.check(parallel.finish(glapi), "succeeded");
+    test.check(parallel.failures().empty(), "no failures");
+    test.check_equal(recorder.call_count("GetShaderInfoLog"), 0, "no log");
+    test.check_equal(parallel.pending_count(), 0, "parallel finished");
+}
+//------------------------------------------------------------------------------
+void recording_spir_v_shader(auto& s) {
+    eagitest::case_ test{s, 9, "SPIR-V shader"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+
+    const std::array<std::uint32_t, 5> module{
+      {0x07230203U, 0x00010000U, 0U, 1U, 0U}};
+    const std::array<gl_types::uint_type, 2> indices{{0U, 1U}};
+    const std::array<gl_types::uint_type, 2> values{{4U, 8U}};
+    spir_v_source_ref src{as_bytes(view(module))};
+    src.specialize(view(indices), view(values));
+    test.check_equal(src.entry_point(), string_view{"main"}, "entry point");
+    test.check_equal(src.binary().size(), 5 * 4, "binary size");
+    test.check_equal(src.constant_values().size(), 2, "constants");
+
+    recorder.clear();
+    gpu_program prog;
+    prog.create(glapi).add_spir_v_shader(glapi, GL.vertex_shader, src);
+    test.check_equal(recorder.call_count("ShaderBinary"), 1, "binary");
+    test.check_equal(recorder.call_count("SpecializeShader"), 1, "specialized");
+    test.check_equal(recorder.call_count("CompileShader"), 0, "not compiled");
+    test.check_equal(recorder.call_count("AttachShader"), 1, "attached");
+
+    // ShaderBinary(count, shaders, format, binary, length) and
+    // SpecializeShader(shader, entry, count, indices, values), packed
+    recorder.for_each_command(
+      [&](const gl_command_id id, const memory::const_block args) {
+          const auto name{gl_command_recorder::command_name(id)};
+          if(name == string_view{"ShaderBinary"}) {
+              gl_types::sizei_type count{};
+              gl_types::enum_type format{};
+              gl_types::sizei_type length{};
+              std::memcpy(&count, args.data(), sizeof(count));
+              std::memcpy(
+                &format, args.data() + sizeof(count) + sizeof(void*), 4U);
+              std::memcpy(
+                &length,
+                args.data() + sizeof(count) + 2U * sizeof(void*) + 4U,
+                sizeof(length));
+              test.check_equal(count, 1, "one shader");
+              test.check_equal(
+                format,
+                gl_types::enum_type(
+                  shader_binary_format{GL.shader_binary_format_spir_v}),
+                "SPIR-V format");
+              test.check_equal(length, 5 * 4, "binary length");
+          } else if(name == string_view{"SpecializeShader"}) {
+              gl_types::uint_type count{};
+              std::memcpy(
+                &count,
+                args.data() + sizeof(gl_types::uint_type) + sizeof(void*),
+                sizeof(count));
+              test.check_equal(count, 2U, "constant count");
+          }
+      });
+    prog.clean_up(glapi);
+}
+//------------------------------------------------------------------------------
+void recording_program_reflection(auto& s) {
+    eagitest::case_ test{s, 10, "program reflection"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+
+    constexpr program_resource_id model{"Model"};
+    test.check(bool(model), "not empty");
+    test.check(not program_resource_id{}, "empty");
+    test.check(model == program_resource_id{string_view{"Model"}}, "same");
+    test.check(model != program_resource_id{"Modell"}, "different");
+
+    // three uniforms, one vertex attribute and one uniform block,
+    // each interface is queried for the resource count and name length
+    const std::array<std::int64_t, 6> interfaces{3, 16, 1, 16, 1, 16};
+    for(const auto value : interfaces) {
+        recorder.add_output("GetProgramInterfaceiv", view(&value, 1));
+    }
+    // the type, location and array size of the uniforms and the attribute
+    const std::array<std::int64_t, 3> model_info{0x8B5C, 3, 1};
+    const std::array<std::int64_t, 3> color_info{0x8B52, 7, 1};
+    const std::array<std::int64_t, 3> tex_info{0x8B5E, 5, 1};
+    const std::array<std::int64_t, 3> position_info{0x8B51, 0, 1};
+    recorder.add_output("GetProgramResourceName", "Model")
+      .add_output("GetProgramResourceName", "Color")
+      .add_output("GetProgramResourceName", "Tex")
+      .add_output("GetProgramResourceName", "Position")
+      .add_output("GetProgramResourceName", "Light")
+      .add_output("GetProgramResourceiv", view(model_info))
+      .add_output("GetProgramResourceiv", view(color_info))
+      .add_output("GetProgramResourceiv", view(tex_info))
+      .add_output("GetProgramResourceiv", view(position_info));
+    recorder.clear();
+    gpu_program prog;
+    prog.create(glapi).link(glapi).reflect(glapi);
+    test.check_equal(
+      recorder.call_count("GetProgramInterfaceiv"), 3 * 2, "interfaces");
+    test.check_equal(recorder.call_count("GetProgramResourceName"), 5, "names");
+    test.check_equal(
+      recorder.call_count("GetProgramResourceiv"), 4, "properties");
+
+    const auto& reflection{prog.reflection()};
+    test.check_equal(reflection.count(), 5, "count");
+    test.check_equal(reflection.uniform(model).location(), 3, "model");
+    test.check_equal(reflection.uniform("Color").location(), 7, "color");
+    test.check_equal(reflection.uniform("Tex").location(), 5, "tex");
+    test.check_equal(
+      reflection.vertex_attrib("Position").index(), 0U, "position");
+    test.check_equal(reflection.uniform_block("Light").index(), 0U, "light");
+    test.check(not reflection.uniform("Position"), "not a uniform");
+    test.check(not reflection.vertex_attrib("Model"), "not an attrib");
+    test.check(not reflection.uniform("Scale"), "no scale");
+
+    // the handles are active only if the uniform type matches
+    const auto model_handle{prog.uniform<mat4>(model)};
+    test.check(bool(model_handle), "mat4 model");
+    test.check_equal(model_handle.location().location(), 3, "model handle");
+    test.check_equal(model_handle.gl_type(), 0x8B5CU, "model type");
+    test.check(bool(prog.uniform<vec4>("Color")), "vec4 color");
+    test.check(not prog.uniform<vec4>(model), "vec4 model");
+    test.check(not prog.uniform<float>("Color"), "float color");
+    test.check(not prog.uniform<float>("Scale"), "no scale handle");
+    // samplers are set to the texture unit index
+    test.check(bool(prog.uniform<int>("Tex")), "int sampler");
+    test.check(not prog.uniform<int>("Color"), "int color");
+    test.check(not prog.uniform<float>("Tex"), "float sampler");
+
+    recorder.clear();
+    prog.set(glapi, prog.uniform<vec4>("Color"), vec4(1.F, 0.F, 0.F, 1.F));
+    test.check(recorder.call_count() > 0, "set color");
+    recorder.clear();
+    prog.set(glapi, prog.uniform<int>("Tex"), 0);
+    test.check(recorder.call_count() > 0, "set sampler");
+    recorder.clear();
+    prog.set(
+      glapi,
+      uniform_handle<vec3>{uniform_location{7}, 0x8B52U},
+      vec3(0.F, 0.F, 0.F));
+    test.check_equal(recorder.call_count(), 0, "type mismatch not set");
+
+    recorder.clear();
+    for(int i = 0; i < 100; ++i) {
+        (void)prog.uniform<float>("Scale");
+    }
+    test.check_equal(recorder.call_count(), 0, "no GL calls");
+
+    prog.clean_up(glapi);
+    test.check(prog.reflection().is_empty(), "cleared");
+}
+//------------------------------------------------------------------------------
+void recording_single_recorder(auto& s) {
+    eagitest::case_ test{s, 11, "single recorder per thread"};
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api first{s.context(), recording_gl_api_traits{recorder}};
+    {
+        gl_command_recorder other;
+        bool rejected{false};
+        try {
+            const recording_gl_api_traits traits{other};
+        } catch(const std::logic_error&) {
+            rejected = true;
+        }
+        test.check(rejected, "other recorder rejected");
+    }
+
+    const gl_api second{s.context(), recording_gl_api_traits{recorder}};
+    recorder.clear();
+    first.operations().enable(first.constants().depth_test);
+    second.operations().disable(second.constants().depth_test);
+    test.check_equal(recorder.call_count("Enable"), 1, "first");
+    test.check_equal(recorder.call_count("Disable"), 1, "second");
+}
+//------------------------------------------------------------------------------
+void recording_call_outputs(auto& s) {
+    eagitest::case_ test{s, 12, "call outputs"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& [gl, GL] = glapi;
+
+    const std::array<std::int64_t, 3> first{0x8B52, 7, 1};
+    const std::array<std::int64_t, 3> second{0x8B5C, 3, 4};
+    recorder.add_output("GetProgramInfoLog", "link failed")
+      .add_output("GetProgramResourceiv", view(first))
+      .add_output("GetProgramResourceiv", view(second))
+      .set_result("GetProgramResourceiv", 0x1406);
+
+    // strings are written with the terminating zero, if they fit
+    std::array<char, 32> log{};
+    gl.get_program_info_log(program_name{1U}, cover(log));
+    test.check(std::string_view{log.data()} == "link failed", "log");
+    log.fill('x');
+    gl.get_program_info_log(program_name{1U}, cover(log));
+    test.check_equal(log.front(), '\0', "no more log");
+
+    // each call of the function takes the next entry
+    gl_types::enum_type type{0U};
+    gl_types::int_type location{0};
+    gl_types::int_type size{0};
+    glapi.get_program_variable_info(
+      program_name{1U}, GL.uniform, 0U, type, location, size);
+    test.check_equal(type, 0x8B52U, "type 1");
+    test.check_equal(location, 7, "location 1");
+    test.check_equal(size, 1, "size 1");
+    glapi.get_program_variable_info(
+      program_name{1U}, GL.uniform, 1U, type, location, size);
+    test.check_equal(type, 0x8B5CU, "type 2");
+    test.check_equal(location, 3, "location 2");
+    test.check_equal(size, 4, "size 2");
+
+    // without entries the first element gets the configured result
+    glapi.get_program_variable_info(
+      program_name{1U}, GL.uniform, 2U, type, location, size);
+    test.check_equal(type, 0x1406U, "type 3");
+    test.check_equal(location, -1, "location 3");
+    test.check_equal(recorder.call_count("GetProgramResourceiv"), 3, "calls");
+}
+//------------------------------------------------------------------------------
+void recording_extension_cache(auto& s) {
+    eagitest::case_ test{s, 13, "extension cache"};
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& gl{glapi.operations()};
+
+    // without any reported extensions nothing is cached
+    recorder.clear();
+    test.check(not gl.has_extension("KHR_debug"), "not yet 1");
+    test.check(not gl.has_extension("KHR_debug"), "not yet 2");
+    test.check_equal(recorder.call_count("GetIntegerv"), 2, "queried twice");
+
+    const char* name{"GL_KHR_debug"};
+    recorder.set_result("GetIntegerv", 1)
+      .set_pointer_result("GetStringi", name);
+    recorder.clear();
+    test.check(gl.has_extension("KHR_debug"), "has 1");
+    test.check(gl.has_extension("KHR_debug"), "has 2");
+    test.check(not gl.has_extension("ARB_robustness"), "has not");
+    test.check_equal(recorder.call_count("GetIntegerv"), 1, "queried once");
+    test.check_equal(recorder.call_count("GetStringi"), 1, "listed once");
+}
+//------------------------------------------------------------------------------
+auto test_main(eagine::test_ctx& ctx) -> int {
+    eagitest::ctx_suite test{ctx, "recording", 13};
+    test.once(recording_generated_names);
+    test.once(recording_command_stream);
+    test.once(recording_configured_results);
+    test.once(recording_program_input_bindings);
+    test.once(recording_offscreen_framebuffer);
+    test.once(recording_geometry_time);
+    test.once(recording_program_binary_cache);
+    test.once(recording_shader_compile_batch);
+    test.once(recording_spir_v_shader);
+    test.once(recording_program_reflection);
+    test.once(recording_single_recorder);
+    test.once(recording_call_outputs);
+    test.once(recording_extension_cache);
+    return test.exit_code();
+}
+//------------------------------------------------------------------------------
+#include <eagine/testing/unit_end_ctx.hpp>
@@ -17,10 +17,39 @@ import :config;
 import :objects;
 import :enum_types;
 import :api;
+import :buffer_ring;
 
 namespace eagine {
 namespace oglplus {
 //------------------------------------------------------------------------------
+// texture compression
+//------------------------------------------------------------------------------
+/// @brief Texel dimensions and byte size of a compressed pixel data block.
+/// @see compression_block_of
+export struct texture_compression_block {
+    gl_types::sizei_type width{1};
+    gl_types::sizei_type height{1};
+    span_size_t size{0};
+
+    /// @brief Returns the byte size of an image with the specified dimensions.
+    auto image_size(
+      const gl_types::sizei_type image_width,
+      const gl_types::sizei_type image_height,
+      const gl_types::sizei_type image_depth) const noexcept -> span_size_t {
+        return span_size((image_width + width - 1) / width) *
+               span_size((image_height + height - 1) / height) *
+               span_size(image_depth) * size;
+    }
+};
+
+/// @brief Returns the block of a compressed internal format.
+///
+/// Supported are the S3TC (BC1-3), RGTC (BC4-5), BPTC (BC6-7), ETC2/EAC
+/// and 2D ASTC formats. Returns nothing for uncompressed formats and for
+/// the generic compressed formats, which have no fixed block layout.
+export auto compression_block_of(const pixel_internal_format) noexcept
+  -> std::optional<texture_compression_block>;
+//------------------------------------------------------------------------------
 // texture build info
 //------------------------------------------------------------------------------
 export struct texture_build_info {
@@ -48,8 +77,35 @@ export struct texture_build_info {
                span_size(bool(depth));
     }
 
+    /// @brief Returns the compression block of the internal format, if any.
+    auto compression_block() const noexcept
+      -> std::optional<texture_compression_block> {
+        if(iformat) {
+            return compression_block_of(*iformat);
+        }
+        return {};
+    }
+
+    /// @brief Indicates if the pixel data is pre-compressed block data.
+    auto is_compressed() const noexcept -> bool {
+        return compression_block().has_value();
+    }
+
+    /// @brief Returns the byte size of compressed data of the specified level.
+    auto compressed_image_size(gl_types::int_type level) const noexcept
+      -> span_size_t {
+        if(const auto block{compression_block()}) {
+            return block->image_size(
+              std::max(width.value_or(1) >> level, 1),
+              std::max(height.value_or(1) >> level, 1),
+              depth.value_or(1));
+        }
+        return 0;
+    }
+
     auto is_complete() const noexcept -> bool {
-        return width and data_type and format and iformat;
+        return width and iformat and
+               ((data_type and format) or is_compressed());
     }
 
     template <typename T>
@@ -111,6 +167,14 @@ export struct texture_build_info {
       const memory::const_block data,
       const basic_gl_api<T>& glapi) const noexcept -> bool;
 
+    template <typename T>
+    auto compressed_texture_image(
+      texture_name tex,
+      texture_target target,
+      gl_types::int_type level,
+      const memory::const_block data,
+      const basic_gl_api<T>& glapi) const noexcept -> bool;
+
     template <typename T>
     auto texture_image(
       texture_name tex,
@@ -118,6 +182,9 @@ export struct texture_build_info {
       gl_types::int_type level,
       const memory::const_block data,
       const basic_gl_api<T>& glapi) const noexcept -> bool {
+        if(is_compressed()) {
+            return compressed_texture_image(tex, target, level, data, glapi);
+        }
         switch(dimensions()) {
             case 3:
                 return texture_image3d(tex, target, level, data, glapi);
@@ -136,6 +203,62 @@ export struct texture_build_info {
       texture_target target,
       const basic_gl_api<T>& glapi) const noexcept -> bool;
 
+    /// @brief Returns the byte size of a single pixel or zero if not known.
+    template <typename T>
+    auto pixel_size(const basic_gl_api<T>& glapi) const noexcept
+      -> span_size_t;
+
+    /// @brief Returns the number of rows (2D) or layers (3D) of the image.
+    /// @see upload_unit_size
+    /// @see texture_sub_image
+    auto upload_unit_count() const noexcept -> span_size_t {
+        switch(dimensions()) {
+            case 3:
+                return span_size(*depth);
+            case 2:
+                return span_size(*height);
+            default:
+                return 0;
+        }
+    }
+
+    /// @brief Returns the byte size of an image row (2D) or layer (3D).
+    /// @see upload_unit_count
+    ///
+    /// Returns zero if the image cannot be specified row-by-row or
+    /// layer-by-layer, for example with 1D images or packed pixel types.
+    template <typename T>
+    auto upload_unit_size(const basic_gl_api<T>& glapi) const noexcept
+      -> span_size_t {
+        if(is_compressed()) {
+            return 0;
+        }
+        const auto row_size{
+          span_size(width.value_or(0)) * span_size(channels.value_or(0)) *
+          pixel_size(glapi)};
+        switch(dimensions()) {
+            case 3:
+                return row_size * span_size(*height);
+            case 2:
+                return row_size;
+            default:
+                return 0;
+        }
+    }
+
+    /// @brief Specifies a range of rows (2D) or layers (3D) of the image.
+    /// @see upload_unit_size
+    /// @pre the texture storage is already specified
+    template <typename T>
+    auto texture_sub_image(
+      texture_name tex,
+      texture_target target,
+      gl_types::int_type level,
+      gl_types::int_type first_unit,
+      gl_types::sizei_type unit_count,
+      const memory::const_block data,
+      const basic_gl_api<T>& glapi) const noexcept -> bool;
+
 private:
     template <typename T, typename P, typename V>
     auto _set_parameter(
@@ -166,7 +289,7 @@ auto texture_build_info::texture_storage1d(
     } else if(glapi.tex_storage1d) {
         return bool(
           glapi.tex_storage1d(target, levels.value_or(1), *iformat, *width));
-    } else if(glapi.tex_image1d) {
+    } else if(glapi.tex_image1d and not is_compressed()) {
         bool result{true};
         auto level_width = *width;
         for(auto level : integer_range(levels.value_or(1))) {
@@ -198,7 +321,7 @@ auto texture_build_info::texture_storage2d(
     } else if(glapi.tex_storage2d) {
         return bool(glapi.tex_storage2d(
           target, levels.value_or(1), *iformat, *width, *height));
-    } else if(glapi.tex_image2d) {
+    } else if(glapi.tex_image2d and not is_compressed()) {
         bool result{true};
         auto level_width = *width;
         auto level_height = *height;
@@ -233,7 +356,7 @@ auto texture_build_info::texture_storage3d(
     } else if(glapi.tex_storage3d) {
         return bool(glapi.tex_storage3d(
           target, levels.value_or(1), *iformat, *width, *height, *depth));
-    } else if(glapi.tex_image3d) {
+    } else if(glapi.tex_image3d and not is_compressed()) {
         bool result{true};
         auto level_width = *width;
         auto level_height = *height;
@@ -347,6 +470,180 @@ auto texture_build_info::texture_image3d(
     return false;
 }
 //------------------------------------------------------------------------------
+template <typename T>
+auto texture_build_info::pixel_size(const basic_gl_api<T>& glapi) const noexcept
+  -> span_size_t {
+    if(data_type) {
+        const auto type{*data_type};
+        if((type == glapi.unsigned_byte_) or (type == glapi.byte_)) {
+            return 1;
+        }
+        if(
+          (type == glapi.unsigned_short_) or (type == glapi.short_) or
+          (type == glapi.half_float_)) {
+            return 2;
+        }
+        if(
+          (type == glapi.unsigned_int_) or (type == glapi.int_) or
+          (type == glapi.float_)) {
+            return 4;
+        }
+    }
+    return 0;
+}
+//------------------------------------------------------------------------------
+template <typename T>
+auto texture_build_info::texture_sub_image(
+  texture_name tex,
+  texture_target target,
+  gl_types::int_type level,
+  gl_types::int_type first_unit,
+  gl_types::sizei_type unit_count,
+  const memory::const_block data,
+  const basic_gl_api<T>& glapi) const noexcept -> bool {
+    switch(dimensions()) {
+        case 3:
+            if(glapi.texture_sub_image3d) {
+                return bool(glapi.texture_sub_image3d(
+                  tex,
+                  level,
+                  0,
+                  0,
+                  first_unit,
+                  *width,
+                  *height,
+                  unit_count,
+                  *format,
+                  *data_type,
+                  data));
+            } else if(glapi.tex_sub_image3d) {
+                return bool(glapi.tex_sub_image3d(
+                  target,
+                  level,
+                  0,
+                  0,
+                  first_unit,
+                  *width,
+                  *height,
+                  unit_count,
+                  *format,
+                  *data_type,
+                  data));
+            }
+            break;
+        case 2:
+            if(glapi.texture_sub_image2d) {
+                return bool(glapi.texture_sub_image2d(
+                  tex,
+                  level,
+                  0,
+                  first_unit,
+                  *width,
+                  unit_count,
+                  *format,
+                  *data_type,
+                  data));
+            } else if(glapi.tex_sub_image2d) {
+                return bool(glapi.tex_sub_image2d(
+                  target,
+                  level,
+                  0,
+                  first_unit,
+                  *width,
+                  unit_count,
+                  *format,
+                  *data_type,
+                  data));
+            }
+            break;
+        default:
+            break;
+    }
+    return false;
+}
+//------------------------------------------------------------------------------
+template <typename T>
+auto texture_build_info::compressed_texture_image(
+  texture_name tex,
+  texture_target target,
+  gl_types::int_type level,
+  memory::const_block data,
+  const basic_gl_api<T>& glapi) const noexcept -> bool {
+    // validate the block data on the CPU, GL would only set an error
+    const auto size{compressed_image_size(level)};
+    if((size <= 0) or (data.size() < size)) {
+        return false;
+    }
+    // data beyond the level image is not used
+    data = head(data, size);
+    const pixel_format fmt{gl_types::enum_type(*iformat)};
+    const auto level_width{std::max(*width >> level, 1)};
+    switch(dimensions()) {
+        case 3:
+            if(glapi.compressed_texture_sub_image3d) {
+                return bool(glapi.compressed_texture_sub_image3d(
+                  tex,
+                  level,
+                  0,
+                  0,
+                  0,
+                  level_width,
+                  std::max(*height >> level, 1),
+                  *depth,
+                  fmt,
+                  data));
+            } else if(glapi.compressed_tex_sub_image3d) {
+                return bool(glapi.compressed_tex_sub_image3d(
+                  target,
+                  level,
+                  0,
+                  0,
+                  0,
+                  level_width,
+                  std::max(*height >> level, 1),
+                  *depth,
+                  fmt,
+                  data));
+            }
+            break;
+        case 2:
+            if(glapi.compressed_texture_sub_image2d) {
+                return bool(glapi.compressed_texture_sub_image2d(
+                  tex,
+                  level,
+                  0,
+                  0,
+                  level_width,
+                  std::max(*height >> level, 1),
+                  fmt,
+                  data));
+            } else if(glapi.compressed_tex_sub_image2d) {
+                return bool(glapi.compressed_tex_sub_image2d(
+                  target,
+                  level,
+                  0,
+                  0,
+                  level_width,
+                  std::max(*height >> level, 1),
+                  fmt,
+                  data));
+            }
+            break;
+        case 1:
+            if(glapi.compressed_texture_sub_image1d) {
+                return bool(glapi.compressed_texture_sub_image1d(
+                  tex, level, 0, level_width, fmt, data));
+            } else if(glapi.compressed_tex_sub_image1d) {
+                return bool(glapi.compressed_tex_sub_image1d(
+                  target, level, 0, level_width, fmt, data));
+            }
+            break;
+        default:
+            break;
+    }
+    return false;
+}
+//------------------------------------------------------------------------------
 template <typename T, typename P, typename V>
 auto texture_build_info::_set_parameter(
   texture_name tex,
@@ -412,13 +709,445 @@ export struct texture_image_build_info {
     std::optional<pixel_data_type> data_type;
     std::optional<pixel_format> format;
     std::optional<pixel_internal_format> iformat;
+
+    /// @brief Returns the width of the image, defaults to the level width.
+    auto image_width(const texture_build_info& tex) const noexcept
+      -> gl_types::sizei_type {
+        return width.value_or(
+          std::max(tex.width.value_or(1) >> level.value_or(0), 1));
+    }
+
+    /// @brief Returns the height of the image, defaults to the level height.
+    auto image_height(const texture_build_info& tex) const noexcept
+      -> gl_types::sizei_type {
+        return height.value_or(
+          std::max(tex.height.value_or(1) >> level.value_or(0), 1));
+    }
+
+    /// @brief Returns the depth of the image, defaults to the texture depth.
+    /// @note The depth of 3D texture levels must be specified explicitly.
+    auto image_depth(const texture_build_info& tex) const noexcept
+      -> gl_types::sizei_type {
+        return depth.value_or(tex.depth.value_or(1));
+    }
+
+    /// @brief Returns the byte size of the image pixel data.
+    /// @see texture_sub_image
+    template <typename T>
+    auto data_size(
+      const texture_build_info& tex,
+      const basic_gl_api<T>& glapi) const noexcept -> span_size_t;
+
+    /// @brief Specifies the image in its level and at its offsets.
+    /// @pre the texture storage is already specified
+    ///
+    /// Unspecified properties of the image are taken from the texture.
+    template <typename T>
+    auto texture_sub_image(
+      texture_name tex_name,
+      texture_target target,
+      const texture_build_info& tex,
+      const memory::const_block data,
+      const basic_gl_api<T>& glapi) const noexcept -> bool;
+
+private:
+    template <typename T>
+    auto _compressed_sub_image(
+      texture_name tex_name,
+      texture_target target,
+      const texture_build_info& tex,
+      const memory::const_block data,
+      const basic_gl_api<T>& glapi) const noexcept -> bool;
 };
 //------------------------------------------------------------------------------
+template <typename T>
+auto texture_image_build_info::data_size(
+  const texture_build_info& tex,
+  const basic_gl_api<T>& glapi) const noexcept -> span_size_t {
+    if(const auto block{tex.compression_block()}) {
+        return block->image_size(
+          image_width(tex), image_height(tex), image_depth(tex));
+    }
+    texture_build_info image{tex};
+    image.channels = channels ? channels : tex.channels;
+    image.data_type = data_type ? data_type : tex.data_type;
+    return span_size(image_width(tex)) * span_size(image_height(tex)) *
+           span_size(image_depth(tex)) *
+           span_size(image.channels.value_or(0)) * image.pixel_size(glapi);
+}
+//------------------------------------------------------------------------------
+template <typename T>
+auto texture_image_build_info::texture_sub_image(
+  texture_name tex_name,
+  texture_target target,
+  const texture_build_info& tex,
+  const memory::const_block data,
+  const basic_gl_api<T>& glapi) const noexcept -> bool {
+    const auto lvl{level.value_or(0)};
+    if(tex.is_compressed()) {
+        return _compressed_sub_image(tex_name, target, tex, data, glapi);
+    }
+    const auto fmt{format ? *format : *tex.format};
+    const auto type{data_type ? *data_type : *tex.data_type};
+    switch(tex.dimensions()) {
+        case 3:
+            if(glapi.texture_sub_image3d) {
+                return bool(glapi.texture_sub_image3d(
+                  tex_name,
+                  lvl,
+                  x_offs.value_or(0),
+                  y_offs.value_or(0),
+                  z_offs.value_or(0),
+                  image_width(tex),
+                  image_height(tex),
+                  image_depth(tex),
+                  fmt,
+                  type,
+                  data));
+            } else if(glapi.tex_sub_image3d) {
+                return bool(glapi.tex_sub_image3d(
+                  target,
+                  lvl,
+                  x_offs.value_or(0),
+                  y_offs.value_or(0),
+                  z_offs.value_or(0),
+                  image_width(tex),
+                  image_height(tex),
+                  image_depth(tex),
+                  fmt,
+                  type,
+                  data));
+            }
+            break;
+        case 2:
+            if(glapi.texture_sub_image2d) {
+                return bool(glapi.texture_sub_image2d(
+                  tex_name,
+                  lvl,
+                  x_offs.value_or(0),
+                  y_offs.value_or(0),
+                  image_width(tex),
+                  image_height(tex),
+                  fmt,
+                  type,
+                  data));
+            } else if(glapi.tex_sub_image2d) {
+                return bool(glapi.tex_sub_image2d(
+                  target,
+                  lvl,
+                  x_offs.value_or(0),
+                  y_offs.value_or(0),
+                  image_width(tex),
+                  image_height(tex),
+                  fmt,
+                  type,
+                  data));
+            }
+            break;
+        case 1:
+            if(glapi.texture_sub_image1d) {
+                return bool(glapi.texture_sub_image1d(
+                  tex_name,
+                  lvl,
+                  x_offs.value_or(0),
+                  image_width(tex),
+                  fmt,
+                  type,
+                  data));
+            } else if(glapi.tex_sub_image1d) {
+                return bool(glapi.tex_sub_image1d(
+                  target,
+                  lvl,
+                  x_offs.value_or(0),
+                  image_width(tex),
+                  fmt,
+                  type,
+                  data));
+            }
+            break;
+        default:
+            break;
+    }
+    return false;
+}
+//------------------------------------------------------------------------------
+template <typename T>
+auto texture_image_build_info::_compressed_sub_image(
+  texture_name tex_name,
+  texture_target target,
+  const texture_build_info& tex,
+  const memory::const_block data,
+  const basic_gl_api<T>& glapi) const noexcept -> bool {
+    if(data.size() != data_size(tex, glapi)) {
+        return false;
+    }
+    const auto lvl{level.value_or(0)};
+    const pixel_format fmt{gl_types::enum_type(*tex.iformat)};
+    switch(tex.dimensions()) {
+        case 3:
+            if(glapi.compressed_texture_sub_image3d) {
+                return bool(glapi.compressed_texture_sub_image3d(
+                  tex_name,
+                  lvl,
+                  x_offs.value_or(0),
+                  y_offs.value_or(0),
+                  z_offs.value_or(0),
+                  image_width(tex),
+                  image_height(tex),
+                  image_depth(tex),
+                  fmt,
+                  data));
+            } else if(glapi.compressed_tex_sub_image3d) {
+                return bool(glapi.compressed_tex_sub_image3d(
+                  target,
+                  lvl,
+                  x_offs.value_or(0),
+                  y_offs.value_or(0),
+                  z_offs.value_or(0),
+                  image_width(tex),
+                  image_height(tex),
+                  image_depth(tex),
+                  fmt,
+                  data));
+            }
+            break;
+        case 2:
+            if(glapi.compressed_texture_sub_image2d) {
+                return bool(glapi.compressed_texture_sub_image2d(
+                  tex_name,
+                  lvl,
+                  x_offs.value_or(0),
+                  y_offs.value_or(0),
+                  image_width(tex),
+                  image_height(tex),
+                  fmt,
+                  data));
+            } else if(glapi.compressed_tex_sub_image2d) {
+                return bool(glapi.compressed_tex_sub_image2d(
+                  target,
+                  lvl,
+                  x_offs.value_or(0),
+                  y_offs.value_or(0),
+                  image_width(tex),
+                  image_height(tex),
+                  fmt,
+                  data));
+            }
+            break;
+        case 1:
+            if(glapi.compressed_texture_sub_image1d) {
+                return bool(glapi.compressed_texture_sub_image1d(
+                  tex_name,
+                  lvl,
+                  x_offs.value_or(0),
+                  image_width(tex),
+                  fmt,
+                  data));
+            } else if(glapi.compressed_tex_sub_image1d) {
+                return bool(glapi.compressed_tex_sub_image1d(
+                  target,
+                  lvl,
+                  x_offs.value_or(0),
+                  image_width(tex),
+                  fmt,
+                  data));
+            }
+            break;
+        default:
+            break;
+    }
+    return false;
+}
+//------------------------------------------------------------------------------
+/// @brief Statistics collected while building a texture from a resource.
+/// @see make_texture_builder
+export struct texture_build_stats {
+    /// @brief The peak size of the buffer staging the decompressed pixel data.
+    span_size_t peak_staging_size{0};
+    /// @brief The number of pixel data bytes specified to GL.
+    span_size_t uploaded_size{0};
+    /// @brief The number of image specification calls.
+    span_size_t upload_count{0};
+    /// @brief The number of uploads from a pixel unpack buffer ring.
+    span_size_t unpack_buffer_upload_count{0};
+    /// @brief The number of uploads straight from the resource data.
+    span_size_t direct_upload_count{0};
+    /// @brief The number of payload chunks decompressed on a decode pool.
+    span_size_t parallel_chunk_count{0};
+};
+//------------------------------------------------------------------------------
+/// @brief Default size of the pixel data staging window of texture builders.
+/// @see make_texture_builder
+export constexpr const span_size_t default_texture_staging_window{
+  4 * 1024 * 1024};
+//------------------------------------------------------------------------------
+/// @brief Ring of persistently mapped pixel unpack buffer segments.
+/// @see make_texture_builder
+/// @see mapped_buffer_ring
+///
+/// Texture builders using the ring copy decompressed pixel data straight
+/// into a mapped segment and specify the texture image from the segment
+/// with the buffer bound to the pixel unpack buffer target. If the ring
+/// cannot be initialized, the texture builders upload from client memory.
+export class pixel_unpack_ring : public mapped_buffer_ring {
+public:
+    using mapped_buffer_ring::mapped_buffer_ring;
+};
+//------------------------------------------------------------------------------
+/// @brief Filters used to generate texture mipmap levels on the CPU.
+/// @see texture_mipmap_generator
+export enum class texture_mipmap_filter {
+    /// @brief Do not generate the mipmap levels.
+    none,
+    /// @brief Average of two texels along each axis.
+    box,
+    /// @brief Four-tap Kaiser-windowed sinc along each axis.
+    kaiser
+};
+//------------------------------------------------------------------------------
+/// @brief Generates the mipmap levels of a texture image on the CPU.
+/// @see make_texture_builder
+///
+/// Each level is computed from the previous one by separable filtering
+/// along the halved axes (width, height and the depth of 3D textures)
+/// and is specified with texture_image. Images with unsigned byte or float
+/// pixel data with one to four channels are supported.
+export class texture_mipmap_generator {
+public:
+    /// @brief Construction with the specified filter.
+    texture_mipmap_generator(const texture_mipmap_filter filter) noexcept
+      : _filter{filter} {}
+
+    /// @brief Indicates if the levels of the specified image can be generated.
+    auto is_supported(const texture_build_info& info, const gl_api& glapi)
+      const noexcept -> bool;
+
+    /// @brief Generates and specifies all levels except the base level.
+    /// @pre is_supported(info, glapi)
+    auto build_levels(
+      texture_name tex,
+      texture_target target,
+      const texture_build_info& info,
+      const memory::const_block base_level,
+      const gl_api& glapi) -> bool;
+
+private:
+    void _filter_axis(
+      const span_size_t inner,
+      const span_size_t count,
+      const span_size_t outer);
+
+    std::vector<float> _current;
+    std::vector<float> _temp;
+    std::vector<byte> _level_data;
+    texture_mipmap_filter _filter;
+};
+//------------------------------------------------------------------------------
+/// @brief Pool of worker threads decoding resources in the background.
+/// @see build_from_resource_async
+/// @see make_texture_builder
+export class resource_decode_pool {
+public:
+    /// @brief Construction with the specified number of worker threads.
+    explicit resource_decode_pool(const span_size_t thread_count);
+
+    resource_decode_pool(resource_decode_pool&&) = delete;
+    resource_decode_pool(const resource_decode_pool&) = delete;
+    auto operator=(resource_decode_pool&&) = delete;
+    auto operator=(const resource_decode_pool&) = delete;
+
+    /// @brief Finishes the already enqueued work and joins the threads.
+    ///
+    /// Texture decoding waiting for a build handle that is not polled
+    /// is cancelled.
+    ~resource_decode_pool() noexcept;
+
+    /// @brief Indicates if the pool is being destroyed.
+    auto is_stopping() const noexcept -> bool {
+        return _stopping.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Returns the number of worker threads.
+    auto thread_count() const noexcept -> span_size_t {
+        return span_size(_threads.size());
+    }
+
+    /// @brief Enqueues a work item to be run on one of the worker threads.
+    void enqueue(std::function<void()> work);
+
+private:
+    void _run() noexcept;
+
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    std::deque<std::function<void()>> _work;
+    std::vector<std::thread> _threads;
+    std::atomic<bool> _stopping{false};
+    bool _done{false};
+};
+//------------------------------------------------------------------------------
+/// @brief Options of the builders of textures from value tree resources.
+/// @see make_texture_builder
+/// @see build_from_resource
+export struct texture_build_options {
+    /// @brief Byte size of the pixel data staged before it is specified.
+    span_size_t staging_window{default_texture_staging_window};
+    /// @brief Filled when the build finishes or fails, if not null.
+    texture_build_stats* stats{nullptr};
+    /// @brief Ring through which the pixel data is streamed, if not null.
+    pixel_unpack_ring* unpack_ring{nullptr};
+    /// @brief Filter generating the mipmap levels on the CPU.
+    texture_mipmap_filter mipmap_filter{texture_mipmap_filter::none};
+    /// @brief Pool decompressing the payload chunks, if not null.
+    resource_decode_pool* decode_pool{nullptr};
+    /// @brief Indicates that the texture storage is already allocated.
+    bool storage_ready{false};
+};
+//------------------------------------------------------------------------------
+/// @brief Makes a builder of a texture from a value tree resource.
+/// @see texture_build_options
+///
+/// Complete rows (of 2D images) or layers (of 3D images) are specified
+/// as soon as staging_window bytes of pixel data have accumulated, so that
+/// the whole image does not need to be kept in memory. If the staging
+/// window is zero or the image cannot be specified progressively, the
+/// whole image is specified at the end. If stats is not null, it is filled
+/// when the build finishes or fails. If unpack_ring is not null and is
+/// initialized, the pixel data is streamed through its segments instead
+/// of the client memory staging window. Uncompressed pixel data is
+/// specified straight from the blocks of the resource whenever they hold
+/// whole rows or layers (or the whole image), the staging buffer is used
+/// only for the rows split between blocks. If mipmap_filter is not none and
+/// the resource specifies more than one level, the whole base level image
+/// is kept and the other levels are generated from it on the CPU.
+///
+/// The resource can list several images (for example pre-computed mipmap
+/// levels or atlas pages) in the image_level, image_x_offs, image_y_offs,
+/// image_z_offs, image_width, image_height and image_depth integer arrays,
+/// the i-th elements of which describe the i-th texture_image_build_info.
+/// The pixel data of these images then follows in the same order, and each
+/// image is specified into its level and at its offsets as soon as its data
+/// is complete.
+///
+/// The data_filter attribute names the data_compression_method used to
+/// compress the pixel data and is read from each resource separately.
+/// Building from a resource with a filter not known to the
+/// data_compression_method enumeration fails, instead of specifying the
+/// still compressed data as pixels.
+///
+/// The payload can also be split into independently compressed chunks of
+/// whole rows or layers, listed in the chunk_units and chunk_data_size
+/// integer arrays (the number of rows or layers and the compressed byte
+/// size of each chunk). If decode_pool is not null, the chunks are then
+/// decompressed concurrently on its threads and each chunk is specified
+/// as soon as it is decoded, otherwise they are decompressed one by one.
 export auto make_texture_builder(
   const gl_api& glapi,
   memory::buffer_pool&,
   texture_name tex,
-  texture_target target) noexcept -> unique_holder<valtree::object_builder>;
+  texture_target target,
+  const texture_build_options& options = {}) noexcept
+  -> unique_holder<valtree::object_builder>;
 //------------------------------------------------------------------------------
 export template <typename T>
 auto build_from_resource(
@@ -426,11 +1155,210 @@ auto build_from_resource(
   const basic_gl_api<T>& glapi,
   const embedded_resource& res,
   texture_name tex,
-  texture_target target) noexcept -> bool {
+  texture_target target,
+  const texture_build_options& options = {}) noexcept -> bool {
     return res.build(
-      ctx, make_texture_builder(glapi, ctx.buffers(), tex, target));
+      ctx, make_texture_builder(glapi, ctx.buffers(), tex, target, options));
 }
 //------------------------------------------------------------------------------
+class async_texture_build_state;
+
+/// @brief Handle of a texture being decoded on a worker thread.
+/// @see build_from_resource_async
+///
+/// The pixel data is decoded and decompressed on a resource_decode_pool
+/// thread and handed over in chunks of whole rows or layers through a
+/// lock-free single-producer single-consumer queue. The GL commands are
+/// issued only from poll, which must be called on the GL thread, for
+/// example once per frame. Destroying an unfinished handle cancels
+/// the decoding.
+export class async_texture_build {
+public:
+    /// @brief Default constructor. Constructs an invalid handle.
+    async_texture_build() noexcept = default;
+
+    /// @brief Construction from the shared build state.
+    explicit async_texture_build(
+      std::shared_ptr<async_texture_build_state> state) noexcept
+      : _state{std::move(state)} {}
+
+    async_texture_build(async_texture_build&&) noexcept = default;
+    async_texture_build(const async_texture_build&) = delete;
+    auto operator=(async_texture_build&&) noexcept -> async_texture_build&;
+    auto operator=(const async_texture_build&) = delete;
+    ~async_texture_build() noexcept;
+
+    /// @brief Indicates if this handle references a texture build.
+    explicit operator bool() const noexcept {
+        return bool(_state);
+    }
+
+    /// @brief Uploads at most max_chunks decoded chunks to GL.
+    /// @see is_finished
+    ///
+    /// Returns true when the build is finished (successfully or not).
+    auto poll(const gl_api& glapi, const span_size_t max_chunks) -> bool;
+
+    /// @brief Uploads all currently decoded chunks to GL.
+    auto poll(const gl_api& glapi) -> bool {
+        return poll(glapi, std::numeric_limits<span_size_t>::max());
+    }
+
+    /// @brief Indicates if the build is finished (successfully or not).
+    auto is_finished() const noexcept -> bool;
+
+    /// @brief Indicates if the build finished successfully.
+    auto succeeded() const noexcept -> bool;
+
+    /// @brief Returns a future that is ready when the build is finished.
+    /// @note The future becomes ready only through calls to poll.
+    /// @pre bool(*this)
+    auto get_future() -> std::future<bool>;
+
+    /// @brief Returns the texture upload statistics collected so far.
+    auto stats() const noexcept -> texture_build_stats;
+
+private:
+    std::shared_ptr<async_texture_build_state> _state;
+};
+//------------------------------------------------------------------------------
+/// @brief Starts decoding of a texture on a worker thread.
+/// @see build_from_resource_async
+///
+/// The build function is called on the worker thread with the value tree
+/// builder decoding the texture data. The GL API is used on the worker
+/// thread only to get the values of constants.
+export auto start_texture_decode(
+  const gl_api& glapi,
+  resource_decode_pool& pool,
+  std::function<bool(unique_holder<valtree::object_builder>)> build,
+  texture_name tex,
+  texture_target target,
+  span_size_t chunk_size) -> async_texture_build;
+//------------------------------------------------------------------------------
+/// @brief Builds a texture from an embedded resource in the background.
+/// @see async_texture_build
+/// @see resource_decode_pool
+///
+/// The main context is not thread-safe, so the resource is fetched and
+/// its header is parsed on the calling thread. The still compressed pixel
+/// data is kept in memory and is decompressed on a worker thread of the
+/// pool. The GL upload happens in async_texture_build::poll on the GL
+/// thread. The GL API wrapper and the pool must outlive the decoding.
+export auto build_from_resource_async(
+  main_ctx& ctx,
+  const gl_api& glapi,
+  resource_decode_pool& pool,
+  const embedded_resource& res,
+  texture_name tex,
+  texture_target target,
+  span_size_t chunk_size = default_texture_staging_window)
+  -> async_texture_build;
+//------------------------------------------------------------------------------
+/// @brief Statistics collected by texture_batch_loader.
+/// @see texture_batch_loader
+export struct texture_batch_stats {
+    /// @brief The number of textures in the batch.
+    span_size_t texture_count{0};
+    /// @brief The number of textures that failed to load.
+    span_size_t failed_count{0};
+    /// @brief The number of pixel data bytes specified to GL.
+    span_size_t uploaded_size{0};
+    /// @brief The number of image specification calls.
+    span_size_t upload_count{0};
+    /// @brief The time spent reading the headers and allocating storage.
+    std::chrono::duration<float> header_time{};
+    /// @brief The time spent decompressing and uploading the pixel data.
+    std::chrono::duration<float> upload_time{};
+
+    /// @brief Returns the aggregate pixel data throughput in MB/s.
+    auto throughput() const noexcept -> float {
+        const auto seconds{(header_time + upload_time).count()};
+        if(seconds > 0.F) {
+            return float(uploaded_size) / (seconds * 1024.F * 1024.F);
+        }
+        return 0.F;
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Loads a batch of textures from embedded resources.
+/// @see build_from_resource
+/// @see texture_batch_stats
+///
+/// Reads the headers of all resources and allocates the storage of all
+/// textures first, then decompresses and uploads the pixel data, largest
+/// images first, sharing the staging buffers between the textures.
+/// Each texture gets bound to its target on the active texture unit while
+/// it is being loaded. The pixel data is decompressed on the calling thread
+/// one texture after another; textures that should be decoded on the
+/// threads of a resource_decode_pool have to be loaded with
+/// build_from_resource_async instead.
+export class texture_batch_loader {
+public:
+    /// @brief Construction with the main context and GL API references.
+    texture_batch_loader(
+      main_ctx& ctx,
+      const gl_api& glapi,
+      span_size_t staging_window = default_texture_staging_window) noexcept
+      : _ctx{ctx}
+      , _glapi{glapi}
+      , _staging_window{staging_window} {}
+
+    /// @brief Adds a texture to be loaded from the specified resource.
+    auto add(
+      const embedded_resource& res,
+      texture_name tex,
+      texture_target target) -> texture_batch_loader& {
+        _entries.push_back({.resource = res, .tex = tex, .target = target});
+        return *this;
+    }
+
+    /// @brief Returns the number of textures in the batch.
+    auto size() const noexcept -> span_size_t {
+        return span_size(_entries.size());
+    }
+
+    /// @brief Loads all textures in the batch.
+    /// @see succeeded
+    /// @see stats
+    ///
+    /// Returns true if all textures were loaded successfully.
+    auto load() -> bool;
+
+    /// @brief Indicates if the texture at the specified index was loaded.
+    auto succeeded(const span_size_t index) const noexcept -> bool {
+        return _entries[std_size(index)].succeeded;
+    }
+
+    /// @brief Returns the statistics of the last load.
+    auto stats() const noexcept -> const texture_batch_stats& {
+        return _stats;
+    }
+
+    /// @brief Removes all textures from the batch.
+    void clear() noexcept {
+        _entries.clear();
+    }
+
+private:
+    struct entry {
+        embedded_resource resource;
+        texture_name tex;
+        texture_target target;
+        texture_build_info info{};
+        bool succeeded{false};
+    };
+
+    auto _read_header(entry&) noexcept -> bool;
+    auto _upload(entry&) noexcept -> bool;
+
+    main_ctx& _ctx;
+    const gl_api& _glapi;
+    span_size_t _staging_window;
+    std::vector<entry> _entries;
+    texture_batch_stats _stats{};
+};
+//------------------------------------------------------------------------------
 } // namespace oglplus
 export template <>
 struct data_member_traits<oglplus::texture_build_info> {
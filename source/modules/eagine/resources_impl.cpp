@@ -15,39 +15,98 @@ import eagine.core.utility;
 import eagine.core.runtime;
 import eagine.core.reflection;
 import eagine.core.value_tree;
+import eagine.core.resource;
+import eagine.core.main_ctx;
 
 namespace eagine::oglplus {
 //------------------------------------------------------------------------------
-class texture_builder : public valtree::object_builder_impl<texture_builder> {
-    using base = valtree::object_builder_impl<texture_builder>;
+// texture_payload_chunk
+//------------------------------------------------------------------------------
+struct texture_payload_chunk {
+    memory::buffer input;
+    memory::buffer output;
+    span_size_t first_unit{0};
+    span_size_t unit_count{0};
 
+    auto append(const memory::const_block blk) noexcept -> bool {
+        memory::append_to(blk, output);
+        return true;
+    }
+};
+//------------------------------------------------------------------------------
+// texture_chunk_queue
+//------------------------------------------------------------------------------
+class texture_chunk_queue {
 public:
-    texture_builder(
-      const gl_api& glapi,
-      memory::buffer_pool& buffers,
-      texture_name tex,
-      texture_target target) noexcept
-      : _glapi{glapi}
-      , _buffers{buffers}
-      , _tex{tex}
-      , _target{target} {}
+    texture_chunk_queue(data_compression_method method) noexcept
+      : _method{method} {}
 
-    auto append_image_data(const memory::const_block blk) noexcept -> bool;
+    void add() noexcept {
+        const std::unique_lock lock{_mutex};
+        ++_pending;
+    }
 
-    void init_decompression(data_compression_method method) noexcept;
+    void decode(std::shared_ptr<texture_payload_chunk> chunk) noexcept;
 
-    template <typename T>
-    void do_add(const basic_string_path& path, span<const T> data) noexcept {
-        _forwarder.forward_data(path, data, _info);
-    }
+    auto pop(bool wait) noexcept -> std::shared_ptr<texture_payload_chunk>;
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    std::deque<std::shared_ptr<texture_payload_chunk>> _decoded;
+    span_size_t _pending{0};
+    const data_compression_method _method;
+};
+//------------------------------------------------------------------------------
+void texture_chunk_queue::decode(
+  std::shared_ptr<texture_payload_chunk> chunk) noexcept {
+    // each chunk is a separate stream, with its own decompressor state
+    memory::buffer_pool buffers;
+    stream_decompression decompression{
+      data_compressor{_method, buffers},
+      make_callable_ref<&texture_payload_chunk::append>(chunk.get()),
+      _method};
+    decompression.next(view(chunk->input));
+    decompression.finish();
 
+    const std::unique_lock lock{_mutex};
+    _decoded.push_back(std::move(chunk));
+    --_pending;
+    _cond.notify_all();
+}
+//------------------------------------------------------------------------------
+auto texture_chunk_queue::pop(bool wait) noexcept
+  -> std::shared_ptr<texture_payload_chunk> {
+    std::unique_lock lock{_mutex};
+    if(wait) {
+        _cond.wait(
+          lock, [this] { return not _decoded.empty() or (_pending == 0); });
+    }
+    if(_decoded.empty()) {
+        return {};
+    }
+    auto chunk{std::move(_decoded.front())};
+    _decoded.pop_front();
+    return chunk;
+}
+//------------------------------------------------------------------------------
+// texture_pixel_builder
+//------------------------------------------------------------------------------
+// the header values and the pixel data decompression shared by the builders
+// specifying a texture image and by the decoders doing it on a pool thread
+template <typename Derived>
+class texture_pixel_builder : public valtree::object_builder_impl<Derived> {
+public:
     void do_add(
       const basic_string_path& path,
       span<const string_view> data) noexcept {
         if(path.is("data_filter")) {
             auto method{data_compression_method::none};
             if(assign_if_fits(data, method)) {
-                init_decompression(method);
+                _derived().init_decompression(method);
+            } else {
+                // the pixel data cannot be decoded with an unknown filter
+                _success = false;
             }
         } else {
             _forwarder.forward_data(path, data, _info);
@@ -58,6 +117,107 @@ public:
         return 64;
     }
 
+protected:
+    template <typename T>
+    void _forward(const basic_string_path& path, span<const T> data) noexcept {
+        _forwarder.forward_data(path, data, _info);
+    }
+
+    // the decompressed data is passed to Derived::append_image_data
+    void _init_decompression(
+      memory::buffer_pool& buffers,
+      data_compression_method method,
+      span_size_t size_hint) noexcept {
+        _pixel_data = buffers.get(size_hint);
+        _pixel_data.clear();
+        _decompression = stream_decompression{
+          data_compressor{method, buffers},
+          make_callable_ref<&Derived::append_image_data>(&_derived()),
+          method};
+    }
+
+    // the number of whole rows or layers of the base level image
+    // in the staged pixel data, that were not specified yet
+    auto _complete_units() const noexcept -> span_size_t {
+        return std::min(
+          _pixel_data.size() / _unit_size,
+          _info.upload_unit_count() - _units_done);
+    }
+
+    // drops the specified leading part of the staged pixel data
+    void _drop_pixel_data(span_size_t size) noexcept {
+        if(size > 0) {
+            const auto rest{_pixel_data.size() - size};
+            std::memmove(
+              _pixel_data.data(), _pixel_data.data() + size, std_size(rest));
+            _pixel_data.resize(rest);
+        }
+    }
+
+    // drops the data of the uploaded units, keeps the incomplete row
+    // or layer for the next upload
+    void _drop_units(span_size_t size) noexcept {
+        if(_units_done >= _info.upload_unit_count()) {
+            // data beyond the base level image is not used
+            _pixel_data.clear();
+        } else {
+            _drop_pixel_data(size);
+        }
+    }
+
+    memory::buffer _pixel_data;
+    stream_decompression _decompression;
+    valtree::object_builder_data_forwarder _forwarder;
+    texture_build_info _info;
+    span_size_t _unit_size{0};
+    span_size_t _units_done{0};
+    bool _success{false};
+
+private:
+    auto _derived() noexcept -> Derived& {
+        return *static_cast<Derived*>(this);
+    }
+};
+//------------------------------------------------------------------------------
+// texture_builder
+//------------------------------------------------------------------------------
+class texture_builder : public texture_pixel_builder<texture_builder> {
+    using base = texture_pixel_builder<texture_builder>;
+
+public:
+    texture_builder(
+      const gl_api& glapi,
+      memory::buffer_pool& buffers,
+      texture_name tex,
+      texture_target target,
+      const texture_build_options& options) noexcept
+      : _glapi{glapi}
+      , _buffers{buffers}
+      , _stats{options.stats}
+      , _unpack_ring{options.unpack_ring}
+      , _decode_pool{options.decode_pool}
+      , _mipmaps{options.mipmap_filter}
+      , _staging_window{options.staging_window}
+      , _tex{tex}
+      , _target{target}
+      , _storage_ready{options.storage_ready} {}
+
+    auto append_image_data(const memory::const_block blk) noexcept -> bool;
+
+    void init_decompression(data_compression_method method) noexcept;
+
+    using base::do_add;
+
+    template <typename T>
+    void do_add(const basic_string_path& path, span<const T> data) noexcept {
+        if constexpr(std::is_integral_v<T>) {
+            if(_add_image_values(path, data) or _add_chunk_values(path, data)) {
+                return;
+            }
+        }
+        _forward(path, data);
+    }
+
     void unparsed_data(span<const memory::const_block> data) noexcept final;
 
     void begin() noexcept final {
@@ -65,29 +225,137 @@ public:
     }
 
     auto handle_texture_storage() noexcept -> bool {
-        return _info.texture_storage(_tex, _target, _glapi);
+        return _storage_ready or _info.texture_storage(_tex, _target, _glapi);
     }
     auto handle_texture_image() noexcept -> bool {
         return _info.texture_image(_tex, _target, 0, view(_pixel_data), _glapi);
     }
+    auto handle_texture_levels() noexcept -> bool {
+        return _mipmaps.build_levels(
+          _tex, _target, _info, view(_pixel_data), _glapi);
+    }
 
     auto finish() noexcept -> bool final;
 
     void failed() noexcept final {
+        if(_segment >= 0) {
+            _unpack_ring->release(_glapi, _segment);
+            _segment = -1;
+        }
+        _update_stats();
         _buffers.eat(std::move(_pixel_data));
+        // the chunks still being decoded are dropped by the pool threads
+        _chunk_queue.reset();
         _success = false;
     }
 
 private:
+    template <typename M, typename T>
+    void _append_image_values(
+      std::optional<M> texture_image_build_info::*member,
+      span<const T> data) noexcept {
+        auto pos{std_size(
+          std::find_if(
+            _images.begin(),
+            _images.end(),
+            [member](const auto& image) { return not(image.*member); }) -
+          _images.begin())};
+        for(const auto value : data) {
+            if(pos == _images.size()) {
+                _images.emplace_back();
+            }
+            _images[pos++].*member = static_cast<M>(value);
+        }
+    }
+
+    template <typename T>
+    auto _add_image_values(
+      const basic_string_path& path,
+      span<const T> data) noexcept -> bool {
+        using I = texture_image_build_info;
+        if(path.is("image_level")) {
+            _append_image_values(&I::level, data);
+        } else if(path.is("image_x_offs")) {
+            _append_image_values(&I::x_offs, data);
+        } else if(path.is("image_y_offs")) {
+            _append_image_values(&I::y_offs, data);
+        } else if(path.is("image_z_offs")) {
+            _append_image_values(&I::z_offs, data);
+        } else if(path.is("image_width")) {
+            _append_image_values(&I::width, data);
+        } else if(path.is("image_height")) {
+            _append_image_values(&I::height, data);
+        } else if(path.is("image_depth")) {
+            _append_image_values(&I::depth, data);
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    template <typename T>
+    auto _add_chunk_values(
+      const basic_string_path& path,
+      span<const T> data) noexcept -> bool {
+        if(path.is("chunk_units")) {
+            for(const auto value : data) {
+                _chunk_units.push_back(span_size(value));
+            }
+        } else if(path.is("chunk_data_size")) {
+            for(const auto value : data) {
+                _chunk_sizes.push_back(span_size(value));
+            }
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    void _begin_payload_chunks() noexcept;
+    void _chunk_data(memory::const_block blk) noexcept;
+    void _submit_chunk() noexcept;
+    auto _upload_decoded_chunks(bool wait) noexcept -> bool;
+    void _begin_progressive() noexcept;
+    auto _upload_images() noexcept -> bool;
+    auto _upload_units(memory::const_block blk) noexcept -> bool;
+    auto _upload_complete_units() noexcept -> bool;
+    auto _whole_image_size() const noexcept -> span_size_t;
+    auto _direct_image_data(memory::const_block blk) noexcept -> bool;
+    auto _stream_image_data(memory::const_block blk) noexcept -> bool;
+    void _flush_segment() noexcept;
+    void _update_stats() noexcept;
+
     const gl_api& _glapi;
     memory::buffer_pool& _buffers;
-    memory::buffer _pixel_data;
-    stream_decompression _decompression;
-    valtree::object_builder_data_forwarder _forwarder;
+    std::vector<texture_image_build_info> _images;
+    texture_build_stats* _stats{nullptr};
+    pixel_unpack_ring* _unpack_ring{nullptr};
+    resource_decode_pool* _decode_pool{nullptr};
+    std::shared_ptr<texture_chunk_queue> _chunk_queue;
+    std::shared_ptr<texture_payload_chunk> _chunk;
+    std::vector<span_size_t> _chunk_units;
+    std::vector<span_size_t> _chunk_sizes;
+    texture_mipmap_generator _mipmaps;
+    texture_build_stats _current_stats{};
+    span_size_t _staging_window{0};
+    span_size_t _images_done{0};
+    span_size_t _segment{-1};
+    span_size_t _segment_fill{0};
+    span_size_t _segment_capacity{0};
+    span_size_t _chunks_sent{0};
+    span_size_t _chunk_first_unit{0};
+    data_compression_method _method{data_compression_method::none};
     texture_name _tex;
     texture_target _target;
-    texture_build_info _info;
-    bool _success{false};
+    bool _storage_ready{false};
+    bool _progressive_checked{false};
+    bool _progressive{false};
+    bool _streaming{false};
+    bool _sectioned{false};
+    bool _direct{false};
+    bool _image_done{false};
+    bool _payload_checked{false};
+    bool _payload_chunked{false};
 };
 //------------------------------------------------------------------------------
 void texture_builder::unparsed_data(
@@ -95,44 +363,378 @@ void texture_builder::unparsed_data(
     if(not _decompression.is_initialized()) {
         init_decompression(data_compression_method::none);
     }
+    if(not _payload_checked) {
+        _begin_payload_chunks();
+    }
     if(_success) {
         for(const auto& blk : data) {
-            _decompression.next(blk);
+            if(_payload_chunked) {
+                _chunk_data(blk);
+            } else if(_direct) {
+                _direct_image_data(blk);
+            } else {
+                _decompression.next(blk);
+            }
         }
     }
 }
 //------------------------------------------------------------------------------
 void texture_builder::init_decompression(
   data_compression_method method) noexcept {
-    _pixel_data = _buffers.get(_info.dimensions() * _info.channels.value_or(1));
-    _pixel_data.clear();
-    _decompression = stream_decompression{
-      data_compressor{method, _buffers},
-      make_callable_ref<&texture_builder::append_image_data>(this),
-      method};
+    // uncompressed pixel data is specified straight from the parsed blocks
+    _direct = method == data_compression_method::none;
+    _method = method;
+    // the progressively specified images are staged in windows
+    const auto size{_info.is_complete() ? _whole_image_size() : 0};
+    _init_decompression(
+      _buffers,
+      method,
+      _staging_window > 0 ? std::min(size, _staging_window) : size);
+}
+//------------------------------------------------------------------------------
+void texture_builder::_begin_payload_chunks() noexcept {
+    _payload_checked = true;
+    if(_chunk_units.empty() and _chunk_sizes.empty()) {
+        return;
+    }
+    // the chunked payload cannot be decoded as a single stream
+    _success =
+      _success and _info.is_complete() and _images.empty() and
+      (_chunk_units.size() == _chunk_sizes.size()) and
+      not _mipmaps.is_supported(_info, _glapi) and
+      (std::accumulate(
+         _chunk_units.begin(), _chunk_units.end(), span_size(0)) ==
+       _info.upload_unit_count());
+    _unit_size = _info.upload_unit_size(_glapi);
+    _success = _success and (_unit_size > 0) and handle_texture_storage();
+    if(_success) {
+        _chunk_queue = std::make_shared<texture_chunk_queue>(_method);
+        _payload_chunked = true;
+    }
+}
+//------------------------------------------------------------------------------
+void texture_builder::_chunk_data(memory::const_block blk) noexcept {
+    const auto count{span_size(_chunk_sizes.size())};
+    while(_success and not blk.empty() and (_chunks_sent < count)) {
+        const auto chunk_size{_chunk_sizes[std_size(_chunks_sent)]};
+        if(chunk_size <= 0) {
+            // a chunk without data cannot hold any rows or layers
+            _success = false;
+            break;
+        }
+        if(not _chunk) {
+            _chunk = std::make_shared<texture_payload_chunk>();
+            _chunk->input = _buffers.get(chunk_size);
+            _chunk->input.clear();
+        }
+        const auto size{
+          std::min(chunk_size - _chunk->input.size(), blk.size())};
+        memory::append_to(head(blk, size), _chunk->input);
+        blk = skip(blk, size);
+        if(_chunk->input.size() == chunk_size) {
+            _submit_chunk();
+        }
+    }
+    _upload_decoded_chunks(false);
+}
+//------------------------------------------------------------------------------
+void texture_builder::_submit_chunk() noexcept {
+    const auto units{_chunk_units[std_size(_chunks_sent)]};
+    _chunk->first_unit = _chunk_first_unit;
+    _chunk->unit_count = units;
+    _chunk_first_unit += units;
+    ++_chunks_sent;
+
+    _chunk_queue->add();
+    if(_decode_pool) {
+        _decode_pool->enqueue(
+          [queue{_chunk_queue}, chunk{std::move(_chunk)}]() mutable {
+              queue->decode(std::move(chunk));
+          });
+        ++_current_stats.parallel_chunk_count;
+    } else {
+        _chunk_queue->decode(std::move(_chunk));
+    }
+    _chunk.reset();
+}
+//------------------------------------------------------------------------------
+auto texture_builder::_upload_decoded_chunks(bool wait) noexcept -> bool {
+    // the chunks are specified in the order in which they got decoded
+    while(auto chunk{_chunk_queue->pop(wait)}) {
+        const auto size{chunk->unit_count * _unit_size};
+        _success =
+          _success and (chunk->output.size() >= size) and
+          _info.texture_sub_image(
+            _tex,
+            _target,
+            0,
+            limit_cast<gl_types::int_type>(chunk->first_unit),
+            limit_cast<gl_types::sizei_type>(chunk->unit_count),
+            head(view(chunk->output), size),
+            _glapi);
+        _units_done += chunk->unit_count;
+        _current_stats.uploaded_size += size;
+        ++_current_stats.upload_count;
+        _buffers.eat(std::move(chunk->input));
+        _buffers.eat(std::move(chunk->output));
+    }
+    return _success;
+}
+//------------------------------------------------------------------------------
+void texture_builder::_begin_progressive() noexcept {
+    _progressive_checked = true;
+    if(_info.is_complete() and not _images.empty()) {
+        // the payload consists of the listed images
+        _success = _success and handle_texture_storage();
+        _sectioned = true;
+        return;
+    }
+    // the mipmap levels are generated from the whole base level image
+    if(_info.is_complete() and not _mipmaps.is_supported(_info, _glapi)) {
+        _unit_size = _info.upload_unit_size(_glapi);
+        const bool can_stream{
+          (_unit_size > 0) and not _direct and _unpack_ring and
+          _unpack_ring->is_initialized() and
+          (_unit_size <= _unpack_ring->segment_size())};
+        if(
+          (_unit_size > 0) and
+          ((_staging_window > 0) or can_stream or _direct)) {
+            _success = _success and handle_texture_storage();
+            _progressive = _success;
+            if(can_stream) {
+                _streaming = true;
+                _segment_capacity =
+                  (_unpack_ring->segment_size() / _unit_size) * _unit_size;
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------
+auto texture_builder::_upload_units(memory::const_block blk) noexcept
+  -> bool {
+    const auto units{std::min(
+      blk.size() / _unit_size, _info.upload_unit_count() - _units_done)};
+    if(units > 0) {
+        const auto size{units * _unit_size};
+        _success = _success and _info.texture_sub_image(
+                                  _tex,
+                                  _target,
+                                  0,
+                                  limit_cast<gl_types::int_type>(_units_done),
+                                  limit_cast<gl_types::sizei_type>(units),
+                                  head(blk, size),
+                                  _glapi);
+        _units_done += units;
+        _current_stats.uploaded_size += size;
+        ++_current_stats.upload_count;
+    }
+    return _success;
+}
+//------------------------------------------------------------------------------
+auto texture_builder::_upload_complete_units() noexcept -> bool {
+    const auto size{_complete_units() * _unit_size};
+    _upload_units(head(view(_pixel_data), size));
+    _drop_units(size);
+    return _success;
+}
+//------------------------------------------------------------------------------
+auto texture_builder::_whole_image_size() const noexcept -> span_size_t {
+    if(_info.is_compressed()) {
+        return _info.compressed_image_size(0);
+    }
+    return span_size(_info.width.value_or(0)) *
+           span_size(_info.height.value_or(1)) *
+           span_size(_info.depth.value_or(1)) *
+           span_size(_info.channels.value_or(0)) * _info.pixel_size(_glapi);
+}
+//------------------------------------------------------------------------------
+auto texture_builder::_direct_image_data(memory::const_block blk) noexcept
+  -> bool {
+    if(not _progressive_checked) {
+        _begin_progressive();
+    }
+    if(_progressive) {
+        // complete the row or layer left over from the previous block
+        if(not _pixel_data.empty()) {
+            const auto size{
+              std::min(_unit_size - _pixel_data.size(), blk.size())};
+            memory::append_to(head(blk, size), _pixel_data);
+            blk = skip(blk, size);
+            if(_pixel_data.size() == _unit_size) {
+                _upload_units(view(_pixel_data));
+                _pixel_data.clear();
+            }
+        }
+        const auto before{_units_done};
+        _upload_units(blk);
+        if(_units_done > before) {
+            ++_current_stats.direct_upload_count;
+        }
+        blk = skip(blk, (_units_done - before) * _unit_size);
+        if(_units_done < _info.upload_unit_count()) {
+            memory::append_to(blk, _pixel_data);
+        }
+        return _success;
+    }
+    if(
+      not _sectioned and _info.is_complete() and
+      not _mipmaps.is_supported(_info, _glapi)) {
+        const auto size{_whole_image_size()};
+        if(_image_done) {
+            // data beyond the base level image is not used
+            return _success;
+        }
+        if(_pixel_data.empty() and (size > 0) and (blk.size() >= size)) {
+            _success = _success and handle_texture_storage() and
+                       _info.texture_image(
+                         _tex, _target, 0, head(blk, size), _glapi);
+            _current_stats.uploaded_size += size;
+            ++_current_stats.upload_count;
+            ++_current_stats.direct_upload_count;
+            _image_done = true;
+            return _success;
+        }
+    }
+    // the data has to be staged
+    return append_image_data(blk);
+}
+//------------------------------------------------------------------------------
+auto texture_builder::_upload_images() noexcept -> bool {
+    while(_success and (_images_done < span_size(_images.size()))) {
+        const auto& image{_images[std_size(_images_done)]};
+        const auto size{image.data_size(_info, _glapi)};
+        if(size <= 0) {
+            _success = false;
+        } else if(_pixel_data.size() >= size) {
+            _success = image.texture_sub_image(
+              _tex, _target, _info, head(view(_pixel_data), size), _glapi);
+            _drop_pixel_data(size);
+            _current_stats.uploaded_size += size;
+            ++_current_stats.upload_count;
+            ++_images_done;
+        } else {
+            break;
+        }
+    }
+    return _success;
+}
+//------------------------------------------------------------------------------
+auto texture_builder::_stream_image_data(memory::const_block blk) noexcept
+  -> bool {
+    while(_success and not blk.empty()) {
+        if(_segment < 0) {
+            _segment = _unpack_ring->acquire(_glapi);
+            _segment_fill = 0;
+        }
+        const auto size{
+          std::min(blk.size(), _segment_capacity - _segment_fill)};
+        std::memcpy(
+          _unpack_ring->segment(_segment).data() + _segment_fill,
+          blk.data(),
+          std_size(size));
+        _segment_fill += size;
+        blk = skip(blk, size);
+        if(_segment_fill == _segment_capacity) {
+            _flush_segment();
+        }
+    }
+    return _success;
+}
+//------------------------------------------------------------------------------
+void texture_builder::_flush_segment() noexcept {
+    const auto units{std::min(
+      _segment_fill / _unit_size, _info.upload_unit_count() - _units_done)};
+    if(units > 0) {
+        const auto& [gl, GL] = _glapi;
+        const auto size{units * _unit_size};
+        gl.bind_buffer(GL.pixel_unpack_buffer, _unpack_ring->buffer());
+        // with the unpack buffer bound, the pointer is an offset into it
+        _success = _success and _info.texture_sub_image(
+                                  _tex,
+                                  _target,
+                                  0,
+                                  limit_cast<gl_types::int_type>(_units_done),
+                                  limit_cast<gl_types::sizei_type>(units),
+                                  memory::const_block{
+                                    memory::typed_nullptr<const byte> +
+                                      _unpack_ring->segment_offset(_segment),
+                                    size},
+                                  _glapi);
+        gl.bind_buffer(GL.pixel_unpack_buffer, no_buffer);
+        _units_done += units;
+        _current_stats.uploaded_size += size;
+        ++_current_stats.upload_count;
+        ++_current_stats.unpack_buffer_upload_count;
+    }
+    _unpack_ring->release(_glapi, _segment);
+    _segment = -1;
+    _segment_fill = 0;
+}
+//------------------------------------------------------------------------------
+void texture_builder::_update_stats() noexcept {
+    if(_stats) {
+        *_stats = _current_stats;
+    }
 }
 //------------------------------------------------------------------------------
 auto texture_builder::append_image_data(const memory::const_block blk) noexcept
   -> bool {
+    if(not _progressive_checked) {
+        _begin_progressive();
+    }
+    if(_streaming) {
+        return _stream_image_data(blk);
+    }
     memory::append_to(blk, _pixel_data);
-    //  TODO: progressive image specification once we have enough
-    //  data for width * some constant so that the temp buffer
-    //  doesn't get too big
-    return true;
+    _current_stats.peak_staging_size =
+      std::max(_current_stats.peak_staging_size, _pixel_data.size());
+    if(_sectioned) {
+        return _upload_images();
+    }
+    if(_progressive and (_pixel_data.size() >= _staging_window)) {
+        return _upload_complete_units();
+    }
+    return _success;
 }
 //------------------------------------------------------------------------------
 auto texture_builder::finish() noexcept -> bool {
     if(_success) {
-        _decompression.finish();
-        if(_info.is_complete()) {
+        if(not _payload_chunked) {
+            _decompression.finish();
+        }
+        if(_payload_chunked) {
+            // wait for the chunks still being decoded
+            _success = _upload_decoded_chunks(true) and
+                       (_chunks_sent == span_size(_chunk_sizes.size())) and
+                       (_units_done == _info.upload_unit_count());
+        } else if(_sectioned) {
+            _success = _upload_images() and
+                       (_images_done == span_size(_images.size()));
+        } else if(_streaming) {
+            if(_segment >= 0) {
+                _flush_segment();
+            }
+        } else if(_progressive) {
+            if(not _pixel_data.empty()) {
+                _upload_complete_units();
+            }
+        } else if(_image_done) {
+            // specified straight from the resource data
+        } else if(_info.is_complete()) {
             _success = _success and handle_texture_storage();
             if(_success and not _pixel_data.empty()) {
                 _success = handle_texture_image();
+                _current_stats.uploaded_size += _pixel_data.size();
+                ++_current_stats.upload_count;
+                if(_success and _mipmaps.is_supported(_info, _glapi)) {
+                    _success = handle_texture_levels();
+                }
             }
         } else {
             _success = false;
         }
     }
+    _update_stats();
     _buffers.eat(std::move(_pixel_data));
     return _success;
 }
@@ -141,8 +743,837 @@ auto make_texture_builder(
   const gl_api& glapi,
   memory::buffer_pool& buffers,
   texture_name tex,
-  texture_target target) noexcept -> unique_holder<valtree::object_builder> {
-    return {hold<texture_builder>, glapi, buffers, tex, target};
+  texture_target target,
+  const texture_build_options& options) noexcept
+  -> unique_holder<valtree::object_builder> {
+    return {hold<texture_builder>, glapi, buffers, tex, target, options};
+}
+//------------------------------------------------------------------------------
+// texture_mipmap_generator
+//------------------------------------------------------------------------------
+auto texture_mipmap_generator::is_supported(
+  const texture_build_info& info,
+  const gl_api& glapi) const noexcept -> bool {
+    if(
+      (_filter == texture_mipmap_filter::none) or
+      (info.levels.value_or(1) <= 1) or not info.is_complete() or
+      not info.data_type or info.is_compressed()) {
+        return false;
+    }
+    const auto channels{info.channels.value_or(0)};
+    if((channels < 1) or (channels > 4)) {
+        return false;
+    }
+    return (*info.data_type == glapi.unsigned_byte_) or
+           (*info.data_type == glapi.float_);
+}
+//------------------------------------------------------------------------------
+void texture_mipmap_generator::_filter_axis(
+  const span_size_t inner,
+  const span_size_t count,
+  const span_size_t outer) {
+    struct tap {
+        span_size_t offset;
+        float weight;
+    };
+    static constexpr const std::array<tap, 2> box_taps{
+      {{0, 0.5F}, {1, 0.5F}}};
+    // Kaiser window (alpha = 4, radius = 2 source texels) applied to sinc
+    // with the cutoff at half of the source frequency, normalized
+    static constexpr const std::array<tap, 4> kaiser_taps{
+      {{-1, 0.0540271F}, {0, 0.4459729F}, {1, 0.4459729F}, {2, 0.0540271F}}};
+    const span<const tap> taps{
+      _filter == texture_mipmap_filter::kaiser ? view(kaiser_taps)
+                                               : view(box_taps)};
+
+    const auto half{std::max(count / 2, span_size(1))};
+    _temp.resize(std_size(outer * half * inner));
+    for(const auto o : integer_range(outer)) {
+        for(const auto i : integer_range(half)) {
+            float* dst{_temp.data() + (o * half + i) * inner};
+            std::fill(dst, dst + inner, 0.F);
+            for(const auto& t : taps) {
+                const auto j{
+                  std::clamp(2 * i + t.offset, span_size(0), count - 1)};
+                const float* src{_current.data() + (o * count + j) * inner};
+                // contiguous inner loop, vectorized by the compiler
+                for(span_size_t k = 0; k < inner; ++k) {
+                    dst[k] += t.weight * src[k];
+                }
+            }
+        }
+    }
+    std::swap(_current, _temp);
+}
+//------------------------------------------------------------------------------
+auto texture_mipmap_generator::build_levels(
+  texture_name tex,
+  texture_target target,
+  const texture_build_info& info,
+  const memory::const_block base_level,
+  const gl_api& glapi) -> bool {
+    const auto channels{span_size(info.channels.value_or(1))};
+    const bool is_float{*info.data_type == glapi.float_};
+    const bool halve_depth{
+      (info.dimensions() == 3) and (target == glapi.texture_3d)};
+    span_size_t width{*info.width};
+    span_size_t height{info.height.value_or(1)};
+    span_size_t depth{info.depth.value_or(1)};
+
+    const auto count{width * height * depth * channels};
+    if(base_level.size() < count * (is_float ? span_size(sizeof(float)) : 1)) {
+        return false;
+    }
+    _current.resize(std_size(count));
+    if(is_float) {
+        std::memcpy(
+          _current.data(), base_level.data(), _current.size() * sizeof(float));
+    } else {
+        std::transform(
+          base_level.begin(),
+          base_level.begin() + count,
+          _current.begin(),
+          [](const byte b) { return float(b); });
+    }
+
+    texture_build_info level_info{info};
+    bool result{true};
+    for(gl_types::int_type level = 1; level < *info.levels; ++level) {
+        if(width > 1) {
+            _filter_axis(channels, width, height * depth);
+            width = std::max(width / 2, span_size(1));
+        }
+        if(info.height and (height > 1)) {
+            _filter_axis(width * channels, height, depth);
+            height = std::max(height / 2, span_size(1));
+        }
+        if(halve_depth and (depth > 1)) {
+            _filter_axis(width * height * channels, depth, 1);
+            depth = std::max(depth / 2, span_size(1));
+        }
+
+        if(is_float) {
+            _level_data.resize(_current.size() * sizeof(float));
+            std::memcpy(
+              _level_data.data(), _current.data(), _level_data.size());
+        } else {
+            _level_data.resize(_current.size());
+            std::transform(
+              _current.begin(),
+              _current.end(),
+              _level_data.begin(),
+              [](const float v) {
+                  return static_cast<byte>(std::clamp(v + 0.5F, 0.F, 255.F));
+              });
+        }
+
+        level_info.width = limit_cast<gl_types::sizei_type>(width);
+        if(info.height) {
+            level_info.height = limit_cast<gl_types::sizei_type>(height);
+        }
+        if(info.depth) {
+            level_info.depth = limit_cast<gl_types::sizei_type>(depth);
+        }
+        result = level_info.texture_image(
+                   tex, target, level, view(_level_data), glapi) and
+                 result;
+    }
+    return result;
+}
+//------------------------------------------------------------------------------
+// resource_decode_pool
+//------------------------------------------------------------------------------
+resource_decode_pool::resource_decode_pool(const span_size_t thread_count) {
+    const auto count{std::max(thread_count, span_size(1))};
+    _threads.reserve(std_size(count));
+    for(const auto i : integer_range(count)) {
+        (void)i;
+        _threads.emplace_back([this] { _run(); });
+    }
+}
+//------------------------------------------------------------------------------
+resource_decode_pool::~resource_decode_pool() noexcept {
+    _stopping.store(true, std::memory_order_relaxed);
+    {
+        const std::unique_lock lock{_mutex};
+        _done = true;
+    }
+    _cond.notify_all();
+    for(auto& thread : _threads) {
+        thread.join();
+    }
+}
+//------------------------------------------------------------------------------
+void resource_decode_pool::enqueue(std::function<void()> work) {
+    {
+        const std::unique_lock lock{_mutex};
+        _work.push_back(std::move(work));
+    }
+    _cond.notify_one();
+}
+//------------------------------------------------------------------------------
+void resource_decode_pool::_run() noexcept {
+    while(true) {
+        std::function<void()> work;
+        {
+            std::unique_lock lock{_mutex};
+            _cond.wait(lock, [this] { return _done or not _work.empty(); });
+            if(_work.empty()) {
+                return;
+            }
+            work = std::move(_work.front());
+            _work.pop_front();
+        }
+        work();
+    }
+}
+//------------------------------------------------------------------------------
+// async_texture_build_state
+//------------------------------------------------------------------------------
+class async_texture_build_state {
+public:
+    struct chunk {
+        span_size_t first_unit{0};
+        // zero means that the chunk contains the whole base level image
+        span_size_t unit_count{0};
+        memory::buffer data;
+    };
+
+    async_texture_build_state(
+      const resource_decode_pool& pool,
+      texture_name tex,
+      texture_target target) noexcept
+      : _pool{pool}
+      , _tex{tex}
+      , _target{target} {}
+
+    // called on the decoding thread
+    void set_info(const texture_build_info& info) noexcept {
+        _info = info;
+        _info_ready.store(true, std::memory_order_release);
+    }
+
+    auto push(chunk c) noexcept -> bool;
+
+    void finish_decode(const bool success) noexcept {
+        _decode_ok.store(success, std::memory_order_relaxed);
+        _decoded.store(true, std::memory_order_release);
+    }
+
+    auto is_cancelled() const noexcept -> bool {
+        return _cancelled.load(std::memory_order_relaxed);
+    }
+
+    // called on the GL thread
+    auto poll(const gl_api& glapi, span_size_t max_chunks) -> bool;
+
+    void cancel() noexcept {
+        _cancelled.store(true, std::memory_order_relaxed);
+    }
+
+    auto is_finished() const noexcept -> bool {
+        return _finished.load(std::memory_order_acquire);
+    }
+
+    auto succeeded() const noexcept -> bool {
+        return is_finished() and _success;
+    }
+
+    auto get_future() -> std::future<bool> {
+        return _promise.get_future();
+    }
+
+    auto stats() const noexcept -> texture_build_stats {
+        return _stats;
+    }
+
+private:
+    static constexpr const std::size_t _chunk_count{8U};
+
+    auto _pop(chunk& c) noexcept -> bool;
+    void _ensure_storage(const gl_api& glapi) noexcept;
+    void _upload(const gl_api& glapi, const chunk& c) noexcept;
+    void _finish(const gl_api& glapi) noexcept;
+
+    // single-producer single-consumer ring, the decoding thread advances
+    // the head and the GL thread advances the tail
+    std::array<chunk, _chunk_count> _chunks;
+    std::atomic<std::size_t> _head{0U};
+    std::atomic<std::size_t> _tail{0U};
+    std::atomic<bool> _info_ready{false};
+    std::atomic<bool> _decoded{false};
+    std::atomic<bool> _decode_ok{false};
+    std::atomic<bool> _cancelled{false};
+    std::atomic<bool> _finished{false};
+    texture_build_info _info;
+    std::promise<bool> _promise;
+    texture_build_stats _stats{};
+    // only used on the decoding threads, while the pool exists
+    const resource_decode_pool& _pool;
+    texture_name _tex;
+    texture_target _target;
+    bool _storage_done{false};
+    bool _success{true};
+};
+//------------------------------------------------------------------------------
+auto async_texture_build_state::push(chunk c) noexcept -> bool {
+    const auto head{_head.load(std::memory_order_relaxed)};
+    while(head - _tail.load(std::memory_order_acquire) >= _chunk_count) {
+        // the GL thread is behind, wait until it consumes some chunks,
+        // unless nobody polls the build and the pool is being destroyed
+        if(_pool.is_stopping()) {
+            cancel();
+        }
+        if(is_cancelled()) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    _chunks[head % _chunk_count] = std::move(c);
+    _head.store(head + 1U, std::memory_order_release);
+    return not is_cancelled();
+}
+//------------------------------------------------------------------------------
+auto async_texture_build_state::_pop(chunk& c) noexcept -> bool {
+    const auto tail{_tail.load(std::memory_order_relaxed)};
+    if(tail == _head.load(std::memory_order_acquire)) {
+        return false;
+    }
+    c = std::move(_chunks[tail % _chunk_count]);
+    _tail.store(tail + 1U, std::memory_order_release);
+    return true;
+}
+//------------------------------------------------------------------------------
+void async_texture_build_state::_ensure_storage(const gl_api& glapi) noexcept {
+    if(not _storage_done and _info_ready.load(std::memory_order_acquire)) {
+        _storage_done = true;
+        _success = _success and _info.texture_storage(_tex, _target, glapi);
+    }
+}
+//------------------------------------------------------------------------------
+void async_texture_build_state::_upload(
+  const gl_api& glapi,
+  const chunk& c) noexcept {
+    // the info is always published before the first chunk
+    _ensure_storage(glapi);
+    if(_success) {
+        if(c.unit_count > 0) {
+            _success = _info.texture_sub_image(
+              _tex,
+              _target,
+              0,
+              limit_cast<gl_types::int_type>(c.first_unit),
+              limit_cast<gl_types::sizei_type>(c.unit_count),
+              view(c.data),
+              glapi);
+        } else {
+            _success =
+              _info.texture_image(_tex, _target, 0, view(c.data), glapi);
+        }
+        _stats.peak_staging_size =
+          std::max(_stats.peak_staging_size, c.data.size());
+        _stats.uploaded_size += c.data.size();
+        ++_stats.upload_count;
+    }
+    if(not _success) {
+        // no point in decoding the rest
+        cancel();
+    }
+}
+//------------------------------------------------------------------------------
+void async_texture_build_state::_finish(const gl_api& glapi) noexcept {
+    _ensure_storage(glapi);
+    _success = _success and _storage_done and
+               _decode_ok.load(std::memory_order_relaxed);
+    _finished.store(true, std::memory_order_release);
+    _promise.set_value(_success);
+}
+//------------------------------------------------------------------------------
+auto async_texture_build_state::poll(
+  const gl_api& glapi,
+  span_size_t max_chunks) -> bool {
+    if(is_finished()) {
+        return true;
+    }
+    // must be loaded before checking the queue, so that no chunk pushed
+    // before the end of decoding can be missed
+    const bool decoded{_decoded.load(std::memory_order_acquire)};
+    if(
+      _info_ready.load(std::memory_order_acquire) and
+      (decoded or (_tail.load(std::memory_order_relaxed) !=
+                   _head.load(std::memory_order_acquire)))) {
+        // other textures may have been bound since the previous poll
+        glapi.bind_texture(_target, _tex);
+    }
+    chunk c;
+    while((max_chunks > 0) and _pop(c)) {
+        _upload(glapi, c);
+        --max_chunks;
+    }
+    if(
+      decoded and (_tail.load(std::memory_order_relaxed) ==
+                   _head.load(std::memory_order_acquire))) {
+        _finish(glapi);
+    }
+    return is_finished();
+}
+//------------------------------------------------------------------------------
+// texture_decoder
+//------------------------------------------------------------------------------
+class texture_decoder : public texture_pixel_builder<texture_decoder> {
+    using base = texture_pixel_builder<texture_decoder>;
+
+public:
+    texture_decoder(
+      const gl_api& glapi,
+      std::shared_ptr<async_texture_build_state> state,
+      span_size_t chunk_size) noexcept
+      : _glapi{glapi}
+      , _state{std::move(state)}
+      , _chunk_size{chunk_size} {}
+
+    auto append_image_data(const memory::const_block blk) noexcept -> bool;
+
+    void init_decompression(data_compression_method method) noexcept;
+
+    using base::do_add;
+
+    template <typename T>
+    void do_add(const basic_string_path& path, span<const T> data) noexcept {
+        if(path.is("chunk_units")) {
+            // independently compressed chunks are decoded by texture_builder
+            _success = false;
+        }
+        _forward(path, data);
+    }
+
+    void unparsed_data(span<const memory::const_block> data) noexcept final;
+
+    void begin() noexcept final {
+        _success = not _state->is_cancelled();
+    }
+
+    auto finish() noexcept -> bool final;
+
+    void failed() noexcept final {
+        _buffers.eat(std::move(_pixel_data));
+        _success = false;
+    }
+
+private:
+    void _begin_chunks() noexcept;
+    auto _push_complete_units() noexcept -> bool;
+
+    // only the GL constants are used on the decoding thread
+    const gl_api& _glapi;
+    std::shared_ptr<async_texture_build_state> _state;
+    // the buffer pool of the main context is not thread-safe
+    memory::buffer_pool _buffers;
+    span_size_t _chunk_size{0};
+    bool _chunks_checked{false};
+    bool _chunked{false};
+};
+//------------------------------------------------------------------------------
+void texture_decoder::unparsed_data(
+  span<const memory::const_block> data) noexcept {
+    if(not _decompression.is_initialized()) {
+        init_decompression(data_compression_method::none);
+    }
+    if(_success) {
+        for(const auto& blk : data) {
+            _decompression.next(blk);
+        }
+    }
+}
+//------------------------------------------------------------------------------
+void texture_decoder::init_decompression(
+  data_compression_method method) noexcept {
+    // the data is staged until there is a whole chunk
+    _init_decompression(_buffers, method, _chunk_size);
+}
+//------------------------------------------------------------------------------
+void texture_decoder::_begin_chunks() noexcept {
+    _chunks_checked = true;
+    if(_info.is_complete()) {
+        _unit_size = _info.upload_unit_size(_glapi);
+        _chunked = (_unit_size > 0) and (_chunk_size > 0);
+        _state->set_info(_info);
+    }
+}
+//------------------------------------------------------------------------------
+auto texture_decoder::_push_complete_units() noexcept -> bool {
+    const auto units{_complete_units()};
+    const auto size{units * _unit_size};
+    if(units > 0) {
+        // the chunk takes over the buffer, the incomplete row or layer
+        // is moved to a new one
+        auto rest{_buffers.get(_chunk_size + _unit_size)};
+        rest.clear();
+        memory::append_to(skip(view(_pixel_data), size), rest);
+        _pixel_data.resize(size);
+        _success = _success and _state->push(
+                                  {.first_unit = _units_done,
+                                   .unit_count = units,
+                                   .data = std::move(_pixel_data)});
+        _pixel_data = std::move(rest);
+        _units_done += units;
+    }
+    // only the incomplete row or layer was left
+    _drop_units(0);
+    return _success;
+}
+//------------------------------------------------------------------------------
+auto texture_decoder::append_image_data(const memory::const_block blk) noexcept
+  -> bool {
+    if(not _chunks_checked) {
+        _begin_chunks();
+    }
+    if(_state->is_cancelled()) {
+        _success = false;
+    }
+    if(_success) {
+        memory::append_to(blk, _pixel_data);
+        if(_chunked and (_pixel_data.size() >= _chunk_size)) {
+            return _push_complete_units();
+        }
+    }
+    return _success;
+}
+//------------------------------------------------------------------------------
+auto texture_decoder::finish() noexcept -> bool {
+    if(_success) {
+        _decompression.finish();
+        if(not _chunks_checked) {
+            _begin_chunks();
+        }
+        if(_chunked) {
+            if(not _pixel_data.empty()) {
+                _push_complete_units();
+            }
+        } else if(_info.is_complete()) {
+            if(not _pixel_data.empty()) {
+                _success = _state->push({.data = std::move(_pixel_data)});
+            }
+        } else {
+            _success = false;
+        }
+    }
+    _buffers.eat(std::move(_pixel_data));
+    return _success;
+}
+//------------------------------------------------------------------------------
+// async_texture_build
+//------------------------------------------------------------------------------
+async_texture_build::~async_texture_build() noexcept {
+    if(_state and not _state->is_finished()) {
+        _state->cancel();
+    }
+}
+//------------------------------------------------------------------------------
+auto async_texture_build::operator=(async_texture_build&& that) noexcept
+  -> async_texture_build& {
+    if(this != &that) {
+        if(_state and not _state->is_finished()) {
+            _state->cancel();
+        }
+        _state = std::move(that._state);
+    }
+    return *this;
+}
+//------------------------------------------------------------------------------
+auto async_texture_build::poll(
+  const gl_api& glapi,
+  const span_size_t max_chunks) -> bool {
+    return not _state or _state->poll(glapi, max_chunks);
+}
+//------------------------------------------------------------------------------
+auto async_texture_build::is_finished() const noexcept -> bool {
+    return not _state or _state->is_finished();
+}
+//------------------------------------------------------------------------------
+auto async_texture_build::succeeded() const noexcept -> bool {
+    return _state and _state->succeeded();
+}
+//------------------------------------------------------------------------------
+auto async_texture_build::get_future() -> std::future<bool> {
+    return _state->get_future();
+}
+//------------------------------------------------------------------------------
+auto async_texture_build::stats() const noexcept -> texture_build_stats {
+    if(_state) {
+        return _state->stats();
+    }
+    return {};
+}
+//------------------------------------------------------------------------------
+auto start_texture_decode(
+  const gl_api& glapi,
+  resource_decode_pool& pool,
+  std::function<bool(unique_holder<valtree::object_builder>)> build,
+  texture_name tex,
+  texture_target target,
+  span_size_t chunk_size) -> async_texture_build {
+    auto state{
+      std::make_shared<async_texture_build_state>(pool, tex, target)};
+    pool.enqueue([&glapi, state, chunk_size, build{std::move(build)}]() {
+        state->finish_decode(build(unique_holder<valtree::object_builder>{
+          hold<texture_decoder>, glapi, state, chunk_size}));
+    });
+    return async_texture_build{std::move(state)};
+}
+//------------------------------------------------------------------------------
+// texture_resource_capture
+//------------------------------------------------------------------------------
+// the header values and the raw pixel data of a texture resource, fetched
+// on the calling thread and decoded later on a pool thread
+struct captured_texture_resource {
+    struct entry {
+        basic_string_path path;
+        std::vector<std::int64_t> integers;
+        std::vector<double> floats;
+        std::vector<std::string> strings;
+    };
+
+    auto replay(unique_holder<valtree::object_builder> builder) const noexcept
+      -> bool;
+
+    std::vector<entry> entries;
+    memory::buffer data;
+};
+//------------------------------------------------------------------------------
+auto captured_texture_resource::replay(
+  unique_holder<valtree::object_builder> builder) const noexcept -> bool {
+    builder->begin();
+    for(const auto& e : entries) {
+        if(not e.integers.empty()) {
+            builder->add(e.path, view(e.integers));
+        }
+        if(not e.floats.empty()) {
+            builder->add(e.path, view(e.floats));
+        }
+        if(not e.strings.empty()) {
+            std::vector<string_view> strings;
+            strings.reserve(e.strings.size());
+            for(const auto& str : e.strings) {
+                strings.emplace_back(str);
+            }
+            builder->add(e.path, view(strings));
+        }
+    }
+    if(not data.empty()) {
+        const std::array<memory::const_block, 1> blocks{view(data)};
+        builder->unparsed_data(view(blocks));
+    }
+    return builder->finish();
+}
+//------------------------------------------------------------------------------
+class texture_resource_capture
+  : public valtree::object_builder_impl<texture_resource_capture> {
+public:
+    texture_resource_capture(
+      std::shared_ptr<captured_texture_resource> captured) noexcept
+      : _captured{std::move(captured)} {}
+
+    template <typename T>
+    void do_add(const basic_string_path& path, span<const T> data) noexcept {
+        auto& e{_entry(path)};
+        for(const auto value : data) {
+            if constexpr(std::is_floating_point_v<T>) {
+                e.floats.push_back(double(value));
+            } else {
+                e.integers.push_back(std::int64_t(value));
+            }
+        }
+    }
+
+    void do_add(
+      const basic_string_path& path,
+      span<const string_view> data) noexcept {
+        auto& e{_entry(path)};
+        for(const auto value : data) {
+            e.strings.emplace_back(value.data(), std_size(value.size()));
+        }
+    }
+
+    auto max_token_size() noexcept -> span_size_t final {
+        return 64;
+    }
+
+    void unparsed_data(span<const memory::const_block> data) noexcept final {
+        for(const auto& blk : data) {
+            memory::append_to(blk, _captured->data);
+        }
+    }
+
+    void begin() noexcept final {
+        _captured->entries.clear();
+        _captured->data.clear();
+        _success = true;
+    }
+
+    auto finish() noexcept -> bool final {
+        return _success;
+    }
+
+    void failed() noexcept final {
+        _success = false;
+    }
+
+private:
+    auto _entry(const basic_string_path& path) noexcept
+      -> captured_texture_resource::entry& {
+        auto& e{_captured->entries.emplace_back()};
+        e.path = path;
+        return e;
+    }
+
+    std::shared_ptr<captured_texture_resource> _captured;
+    bool _success{false};
+};
+//------------------------------------------------------------------------------
+auto build_from_resource_async(
+  main_ctx& ctx,
+  const gl_api& glapi,
+  resource_decode_pool& pool,
+  const embedded_resource& res,
+  texture_name tex,
+  texture_target target,
+  span_size_t chunk_size) -> async_texture_build {
+    // the main context is used only here, on the calling thread
+    auto captured{std::make_shared<captured_texture_resource>()};
+    const bool fetched{res.build(
+      ctx,
+      unique_holder<valtree::object_builder>{
+        hold<texture_resource_capture>, captured})};
+    return start_texture_decode(
+      glapi,
+      pool,
+      [fetched, captured{std::move(captured)}](
+        unique_holder<valtree::object_builder> builder) {
+          return fetched and captured->replay(std::move(builder));
+      },
+      tex,
+      target,
+      chunk_size);
+}
+//------------------------------------------------------------------------------
+// texture_batch_loader
+//------------------------------------------------------------------------------
+class texture_header_reader
+  : public valtree::object_builder_impl<texture_header_reader> {
+    using base = valtree::object_builder_impl<texture_header_reader>;
+
+public:
+    texture_header_reader(texture_build_info& info) noexcept
+      : _info{info} {}
+
+    template <typename T>
+    void do_add(const basic_string_path& path, span<const T> data) noexcept {
+        _forwarder.forward_data(path, data, _info);
+    }
+
+    void do_add(
+      const basic_string_path& path,
+      span<const string_view> data) noexcept {
+        if(not path.is("data_filter")) {
+            _forwarder.forward_data(path, data, _info);
+        }
+    }
+
+    auto max_token_size() noexcept -> span_size_t final {
+        return 64;
+    }
+
+    void unparsed_data(span<const memory::const_block>) noexcept final {
+        // the pixel data is not needed yet
+    }
+
+    void begin() noexcept final {
+        _info = {};
+    }
+
+    auto finish() noexcept -> bool final {
+        return _info.is_complete();
+    }
+
+private:
+    valtree::object_builder_data_forwarder _forwarder;
+    texture_build_info& _info;
+};
+//------------------------------------------------------------------------------
+auto texture_batch_loader::_read_header(entry& e) noexcept -> bool {
+    if(e.resource.build(_ctx, {hold<texture_header_reader>, e.info})) {
+        _glapi.bind_texture(e.target, e.tex);
+        return e.info.texture_storage(e.tex, e.target, _glapi);
+    }
+    return false;
+}
+//------------------------------------------------------------------------------
+auto texture_batch_loader::_upload(entry& e) noexcept -> bool {
+    _glapi.bind_texture(e.target, e.tex);
+    texture_build_stats stats;
+    const bool result{e.resource.build(
+      _ctx,
+      {hold<texture_builder>,
+       _glapi,
+       _ctx.buffers(),
+       e.tex,
+       e.target,
+       texture_build_options{
+         .staging_window = _staging_window,
+         .stats = &stats,
+         .storage_ready = true}})};
+    _stats.uploaded_size += stats.uploaded_size;
+    _stats.upload_count += stats.upload_count;
+    return result;
+}
+//------------------------------------------------------------------------------
+auto texture_batch_loader::load() -> bool {
+    using clock = std::chrono::steady_clock;
+    _stats = {};
+    _stats.texture_count = size();
+
+    const auto start{clock::now()};
+    std::vector<entry*> order;
+    order.reserve(_entries.size());
+    for(auto& e : _entries) {
+        e.succeeded = _read_header(e);
+        if(e.succeeded) {
+            order.push_back(&e);
+        }
+    }
+    const auto headers_read{clock::now()};
+
+    // the large images first, so that their transfers can overlap
+    // with the decompression of the smaller ones
+    const auto image_size{[this](const entry* e) {
+        return e->info.upload_unit_count() *
+               e->info.upload_unit_size(_glapi);
+    }};
+    std::stable_sort(
+      order.begin(), order.end(), [&](const entry* l, const entry* r) {
+          return image_size(l) > image_size(r);
+      });
+    for(auto* e : order) {
+        e->succeeded = _upload(*e);
+    }
+    const auto finished{clock::now()};
+
+    _stats.header_time = headers_read - start;
+    _stats.upload_time = finished - headers_read;
+    _stats.failed_count = span_size(std::count_if(
+      _entries.begin(), _entries.end(), [](const entry& e) {
+          return not e.succeeded;
+      }));
+
+    _ctx.log()
+      .info("loaded texture batch")
+      .arg("count", _stats.texture_count)
+      .arg("failed", _stats.failed_count)
+      .arg("size", _stats.uploaded_size)
+      .arg("MBps", _stats.throughput());
+
+    return _stats.failed_count == 0;
 }
 //------------------------------------------------------------------------------
 } // namespace eagine::oglplus
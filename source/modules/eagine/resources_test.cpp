@@ -0,0 +1,909 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+
+#include <eagine/testing/unit_begin_ctx.hpp>
+import std;
+import eagine.core;
+import eagine.oglplus;
+//------------------------------------------------------------------------------
+void resources_upload_unit_size(auto& s) {
+    eagitest::case_ test{s, 1, "texture upload unit size"};
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+
+    texture_build_info info;
+    info.width = 256;
+    info.height = 256;
+    info.channels = 4;
+    info.data_type = GL.unsigned_byte_;
+    info.format = GL.rgba;
+    info.iformat = GL.rgba8;
+
+    test.check_equal(info.pixel_size(glapi), 1, "pixel size");
+    test.check_equal(info.upload_unit_count(), 256, "row count");
+    test.check_equal(info.upload_unit_size(glapi), 256 * 4, "row size");
+
+    info.depth = 768;
+    info.channels = 1;
+    info.data_type = GL.float_;
+    test.check_equal(info.upload_unit_count(), 768, "layer count");
+    test.check_equal(
+      info.upload_unit_size(glapi), 256 * 256 * 4, "layer size");
+
+    info.channels.reset();
+    test.check_equal(info.upload_unit_size(glapi), 0, "unknown channels");
+}
+//------------------------------------------------------------------------------
+void resources_sub_image_layers(auto& s) {
+    eagitest::case_ test{s, 2, "texture sub image layers"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+
+    texture_build_info info;
+    info.width = 64;
+    info.height = 64;
+    info.depth = 96;
+    info.channels = 1;
+    info.data_type = GL.unsigned_byte_;
+    info.format = GL.red;
+    info.iformat = GL.r8;
+
+    const auto unit_size{info.upload_unit_size(glapi)};
+    const span_size_t window{16 * 64 * 64};
+    const auto units_per_upload{window / unit_size};
+    std::vector<byte> layers(std_size(window));
+
+    recorder.clear();
+    span_size_t uploads{0};
+    for(span_size_t z = 0; z < info.upload_unit_count();
+        z += units_per_upload) {
+        test.check(
+          info.texture_sub_image(
+            texture_name{1U},
+            GL.texture_2d_array,
+            0,
+            limit_cast<gl_types::int_type>(z),
+            limit_cast<gl_types::sizei_type>(units_per_upload),
+            view(layers),
+            glapi),
+          "sub image");
+        ++uploads;
+    }
+
+    test.check_equal(uploads, 6, "uploads");
+    test.check_equal(
+      recorder.call_count("TextureSubImage3D") +
+        recorder.call_count("TexSubImage3D"),
+      uploads,
+      "calls");
+}
+//------------------------------------------------------------------------------
+void resources_unpack_ring_unmapped(auto& s) {
+    eagitest::case_ test{s, 3, "unpack ring without mapping"};
+    using namespace eagine::oglplus;
+
+    // the recording stubs return null from map_buffer_range,
+    // which is what the ring has to handle gracefully
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+
+    pixel_unpack_ring ring{1024 * 1024, 4};
+    test.check_equal(ring.segment_count(), 4, "segment count");
+    test.check_equal(ring.segment_offset(2), 2 * 1024 * 1024, "offset");
+
+    test.check(not ring.init(glapi), "not initialized");
+    test.check(not ring, "not mapped");
+    test.check_equal(
+      recorder.call_count("GenBuffers"),
+      recorder.call_count("DeleteBuffers"),
+      "buffer cleaned up");
+
+    ring.clean_up(glapi);
+}
+//------------------------------------------------------------------------------
+void resources_decode_pool(auto& s) {
+    eagitest::case_ test{s, 4, "resource decode pool"};
+    using namespace eagine::oglplus;
+
+    std::atomic<int> done{0};
+    {
+        resource_decode_pool pool{3};
+        test.check_equal(pool.thread_count(), 3, "thread count");
+        for(int i = 0; i < 100; ++i) {
+            pool.enqueue([&done] { ++done; });
+        }
+    }
+    test.check_equal(done.load(), 100, "all work done");
+}
+//------------------------------------------------------------------------------
+void resources_async_failed_decode(auto& s) {
+    eagitest::case_ test{s, 5, "failed asynchronous decode"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+    resource_decode_pool pool{1};
+
+    auto build{start_texture_decode(
+      glapi,
+      pool,
+      [](unique_holder<valtree::object_builder>) { return false; },
+      texture_name{1U},
+      GL.texture_2d,
+      default_texture_staging_window)};
+    auto result{build.get_future()};
+
+    recorder.clear();
+    while(not build.poll(glapi)) {
+        std::this_thread::yield();
+    }
+
+    test.check(build.is_finished(), "finished");
+    test.check(not build.succeeded(), "not succeeded");
+    test.check(not result.get(), "future result");
+    test.check_equal(build.stats().upload_count, 0, "no uploads");
+    test.check_equal(recorder.call_count(), 0, "no GL calls");
+}
+//------------------------------------------------------------------------------
+void resources_batch_throughput(auto& s) {
+    eagitest::case_ test{s, 6, "texture batch throughput"};
+    using namespace eagine::oglplus;
+
+    texture_batch_stats stats;
+    test.check_equal(stats.throughput(), 0.F, "empty");
+
+    stats.uploaded_size = 48 * 1024 * 1024;
+    stats.header_time = std::chrono::duration<float>{0.5F};
+    stats.upload_time = std::chrono::duration<float>{1.5F};
+    test.check_equal(stats.throughput(), 24.F, "MB/s");
+}
+//------------------------------------------------------------------------------
+void resources_mipmap_levels(auto& s) {
+    eagitest::case_ test{s, 7, "mipmap level generation"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+
+    texture_build_info info;
+    info.levels = 4;
+    info.width = 8;
+    info.height = 4;
+    info.channels = 3;
+    info.data_type = GL.unsigned_byte_;
+    info.format = GL.rgb;
+    info.iformat = GL.rgb8;
+
+    texture_mipmap_generator none{texture_mipmap_filter::none};
+    texture_mipmap_generator box{texture_mipmap_filter::box};
+    texture_mipmap_generator kaiser{texture_mipmap_filter::kaiser};
+    test.check(not none.is_supported(info, glapi), "none");
+    test.check(box.is_supported(info, glapi), "box");
+    test.check(kaiser.is_supported(info, glapi), "kaiser");
+
+    std::vector<byte> base(8 * 4 * 3, byte(200));
+    recorder.clear();
+    test.check(
+      box.build_levels(
+        texture_name{1U}, GL.texture_2d, info, view(base), glapi),
+      "box levels");
+    test.check(
+      kaiser.build_levels(
+        texture_name{1U}, GL.texture_2d, info, view(base), glapi),
+      "kaiser levels");
+    test.check_equal(
+      recorder.call_count("TextureSubImage2D") +
+        recorder.call_count("TexImage2D"),
+      2 * 3,
+      "level uploads");
+
+    info.channels = 5;
+    test.check(not box.is_supported(info, glapi), "channels");
+    info.channels = 1;
+    info.data_type = GL.unsigned_short_;
+    test.check(not box.is_supported(info, glapi), "data type");
+}
+//------------------------------------------------------------------------------
+void resources_image_sections(auto& s) {
+    eagitest::case_ test{s, 8, "texture image sections"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+
+    texture_build_info info;
+    info.levels = 3;
+    info.width = 64;
+    info.height = 32;
+    info.channels = 4;
+    info.data_type = GL.unsigned_byte_;
+    info.format = GL.rgba;
+    info.iformat = GL.rgba8;
+
+    texture_image_build_info level2;
+    level2.level = 2;
+    test.check_equal(level2.image_width(info), 16, "level width");
+    test.check_equal(level2.image_height(info), 8, "level height");
+    test.check_equal(level2.data_size(info, glapi), 16 * 8 * 4, "level size");
+
+    texture_image_build_info page;
+    page.x_offs = 32;
+    page.width = 32;
+    page.height = 32;
+    test.check_equal(page.data_size(info, glapi), 32 * 32 * 4, "page size");
+
+    std::vector<byte> data(std_size(page.data_size(info, glapi)));
+    recorder.clear();
+    test.check(
+      level2.texture_sub_image(
+        texture_name{1U}, GL.texture_2d, info, view(data), glapi),
+      "level image");
+    test.check(
+      page.texture_sub_image(
+        texture_name{1U}, GL.texture_2d, info, view(data), glapi),
+      "page image");
+    test.check_equal(
+      recorder.call_count("TextureSubImage2D") +
+        recorder.call_count("TexSubImage2D"),
+      2,
+      "calls");
+}
+//------------------------------------------------------------------------------
+void resources_compressed_image(auto& s) {
+    eagitest::case_ test{s, 9, "compressed texture image"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+
+    texture_build_info info;
+    info.width = 30;
+    info.height = 20;
+    info.iformat = GL.rgba8;
+    test.check(not info.is_compressed(), "uncompressed");
+    test.check(not info.is_complete(), "incomplete");
+
+    info.iformat = GL.compressed_srgb8_etc2;
+    test.check(info.is_compressed(), "compressed");
+    test.check(info.is_complete(), "complete");
+    test.check_equal(info.upload_unit_size(glapi), 0, "no rows");
+    test.check_equal(info.compressed_image_size(0), 8 * 5 * 8, "size");
+    test.check_equal(info.compressed_image_size(1), 4 * 3 * 8, "level size");
+
+    std::vector<byte> data(std_size(info.compressed_image_size(0)));
+    recorder.clear();
+    test.check(
+      not info.texture_image(
+        texture_name{1U}, GL.texture_2d, 0, head(view(data), 100), glapi),
+      "short data");
+    test.check(
+      info.texture_image(
+        texture_name{1U}, GL.texture_2d, 0, view(data), glapi),
+      "image");
+    test.check_equal(
+      recorder.call_count("CompressedTextureSubImage2D") +
+        recorder.call_count("CompressedTexSubImage2D"),
+      1,
+      "calls");
+}
+//------------------------------------------------------------------------------
+void add_rgba8_texture_header(
+  auto& builder,
+  const std::int64_t width,
+  const std::int64_t height,
+  const eagine::string_view data_filter) {
+    using namespace eagine;
+    const auto add{[&](string_view name, auto value) {
+        basic_string_path path;
+        path.push_back(name);
+        const std::array<decltype(value), 1> values{value};
+        builder->add(path, view(values));
+    }};
+    add("levels", std::int64_t{1});
+    add("width", width);
+    add("height", height);
+    add("channels", std::int64_t{4});
+    add("data_type", string_view{"unsigned_byte"});
+    add("format", string_view{"rgba"});
+    add("iformat", string_view{"rgba8"});
+    add("data_filter", data_filter);
+}
+//------------------------------------------------------------------------------
+void resources_texture_builder(auto& s) {
+    eagitest::case_ test{s, 10, "texture builder"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+    memory::buffer_pool buffers;
+
+    const auto build{[&](string_view data_filter, texture_build_stats& stats) {
+        auto builder{make_texture_builder(
+          glapi,
+          buffers,
+          texture_name{1U},
+          GL.texture_2d,
+          {.stats = &stats})};
+        builder->begin();
+        add_rgba8_texture_header(builder, 4, 4, data_filter);
+
+        const std::vector<byte> pixels(4 * 4 * 4, byte(0x7F));
+        const std::array<memory::const_block, 1> blocks{view(pixels)};
+        builder->unparsed_data(view(blocks));
+        return builder->finish();
+    }};
+
+    texture_build_stats stats;
+    recorder.clear();
+    test.check(build("none", stats), "built");
+    test.check_equal(stats.upload_count, 1, "upload count");
+    test.check_equal(stats.direct_upload_count, 1, "direct upload");
+    test.check_equal(stats.uploaded_size, 4 * 4 * 4, "uploaded size");
+    test.check_equal(
+      recorder.call_count("TextureStorage2D") +
+        recorder.call_count("TexStorage2D"),
+      1,
+      "storage calls");
+    test.check_equal(
+      recorder.call_count("TextureSubImage2D") +
+        recorder.call_count("TexSubImage2D"),
+      1,
+      "image calls");
+
+    texture_build_stats failed_stats;
+    recorder.clear();
+    test.check(not build("unknown-filter", failed_stats), "unknown filter");
+    test.check_equal(failed_stats.upload_count, 0, "no uploads");
+    test.check_equal(
+      recorder.call_count("TextureSubImage2D") +
+        recorder.call_count("TexSubImage2D"),
+      0,
+      "no image calls");
+}
+//------------------------------------------------------------------------------
+void resources_async_unpolled(auto& s) {
+    eagitest::case_ test{s, 11, "unpolled asynchronous decode"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+
+    // one row per chunk, more chunks than fit into the queue
+    const std::int64_t rows{32};
+    const std::vector<byte> pixels(std_size(rows * 16 * 4), byte(0x7F));
+    std::vector<memory::const_block> blocks;
+    for(const auto row : integer_range(rows)) {
+        blocks.push_back(head(skip(view(pixels), row * 16 * 4), 16 * 4));
+    }
+
+    async_texture_build build;
+    {
+        resource_decode_pool pool{1};
+        build = start_texture_decode(
+          glapi,
+          pool,
+          [&](unique_holder<valtree::object_builder> builder) {
+              builder->begin();
+              add_rgba8_texture_header(builder, 16, rows, "none");
+              builder->unparsed_data(view(blocks));
+              return builder->finish();
+          },
+          texture_name{1U},
+          GL.texture_2d,
+          16 * 4);
+        // the pool is destroyed while nobody polls the build
+    }
+    test.check(not build.is_finished(), "not finished");
+
+    while(not build.poll(glapi)) {
+        std::this_thread::yield();
+    }
+    test.check(build.is_finished(), "finished");
+    test.check(not build.succeeded(), "cancelled");
+}
+//------------------------------------------------------------------------------
+void resources_async_build(auto& s) {
+    eagitest::case_ test{s, 13, "asynchronous texture build"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+
+    // one row per block, two rows per chunk
+    const std::int64_t rows{4};
+    const std::vector<byte> pixels(std_size(rows * 16 * 4), byte(0x7F));
+    std::vector<memory::const_block> blocks;
+    for(const auto row : integer_range(rows)) {
+        blocks.push_back(head(skip(view(pixels), row * 16 * 4), 16 * 4));
+    }
+
+    recorder.clear();
+    resource_decode_pool pool{1};
+    auto build{start_texture_decode(
+      glapi,
+      pool,
+      [&](unique_holder<valtree::object_builder> builder) {
+          builder->begin();
+          add_rgba8_texture_header(builder, 16, rows, "none");
+          builder->unparsed_data(view(blocks));
+          return builder->finish();
+      },
+      texture_name{1U},
+      GL.texture_2d,
+      2 * 16 * 4)};
+    while(not build.poll(glapi)) {
+        std::this_thread::yield();
+    }
+    test.check(build.succeeded(), "succeeded");
+    test.check_equal(build.stats().upload_count, 2, "upload count");
+    test.check_equal(build.stats().uploaded_size, rows * 16 * 4, "size");
+
+    // the texture is bound before its storage is allocated, the rows
+    // are specified in order, two at a time
+    int bind_pos{-1};
+    int storage_pos{-1};
+    std::vector<std::pair<int, std::pair<int, int>>> sub_images;
+    int pos{0};
+    recorder.for_each_command(
+      [&](const gl_command_id id, const memory::const_block args) {
+          const auto name{gl_command_recorder::command_name(id)};
+          if((name == string_view{"BindTexture"}) and (bind_pos < 0)) {
+              bind_pos = pos;
+          } else if(
+            (name == string_view{"TextureStorage2D"}) or
+            (name == string_view{"TexStorage2D"})) {
+              storage_pos = pos;
+          } else if(
+            (name == string_view{"TextureSubImage2D"}) or
+            (name == string_view{"TexSubImage2D"})) {
+              // texture or target, level, xoffset, yoffset, width, height
+              gl_types::int_type yoffset{0};
+              gl_types::sizei_type height{0};
+              std::memcpy(&yoffset, args.data() + 12, sizeof(yoffset));
+              std::memcpy(&height, args.data() + 20, sizeof(height));
+              sub_images.push_back({pos, {yoffset, height}});
+          }
+          ++pos;
+      });
+    test.check(bind_pos >= 0, "bound");
+    test.check(bind_pos < storage_pos, "bound before storage");
+    test.check_equal(sub_images.size(), 2U, "sub images");
+    if(sub_images.size() == 2U) {
+        test.check(storage_pos < sub_images[0].first, "storage first");
+        test.check_equal(sub_images[0].second.first, 0, "first offset");
+        test.check_equal(sub_images[0].second.second, 2, "first height");
+        test.check_equal(sub_images[1].second.first, 2, "second offset");
+        test.check_equal(sub_images[1].second.second, 2, "second height");
+    }
+}
+//------------------------------------------------------------------------------
+void resources_chunked_payload(auto& s) {
+    eagitest::case_ test{s, 14, "chunked texture payload"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+    memory::buffer_pool buffers;
+
+    // two rows of 16 texels with all bytes 0x7F, compressed with zlib
+    const std::array<std::uint8_t, 12> chunk{
+      {0x78, 0x9C, 0xAB, 0xAF, 0x1F, 0x58, 0x00, 0x00, 0x01, 0x30, 0x3F, 0x81}};
+    std::vector<std::uint8_t> payload;
+    payload.insert(payload.end(), chunk.begin(), chunk.end());
+    payload.insert(payload.end(), chunk.begin(), chunk.end());
+    const auto data{as_bytes(view(payload))};
+
+    const auto build{[&](
+                       resource_decode_pool* pool,
+                       const std::int64_t chunk_size,
+                       const memory::const_block input,
+                       texture_build_stats& stats) {
+        auto builder{make_texture_builder(
+          glapi,
+          buffers,
+          texture_name{1U},
+          GL.texture_2d,
+          {.stats = &stats, .decode_pool = pool})};
+        builder->begin();
+        add_rgba8_texture_header(builder, 16, 4, "zlib");
+        const auto add{[&](string_view name, std::int64_t value) {
+            basic_string_path path;
+            path.push_back(name);
+            const std::array<std::int64_t, 2> values{value, value};
+            builder->add(path, view(values));
+        }};
+        add("chunk_units", 2);
+        add("chunk_data_size", chunk_size);
+        const std::array<memory::const_block, 1> blocks{input};
+        builder->unparsed_data(view(blocks));
+        return builder->finish();
+    }};
+
+    // TextureSubImage2D(texture, level, xoffset, yoffset, width, height, ...)
+    // and TexSubImage2D(target, ...) have the same packed layout
+    const auto sub_image_rows{[&] {
+        std::vector<std::pair<int, int>> rows;
+        recorder.for_each_command(
+          [&](const gl_command_id id, const memory::const_block args) {
+              const auto name{gl_command_recorder::command_name(id)};
+              if(
+                (name == string_view{"TextureSubImage2D"}) or
+                (name == string_view{"TexSubImage2D"})) {
+                  gl_types::int_type yoffset{0};
+                  gl_types::sizei_type height{0};
+                  std::memcpy(&yoffset, args.data() + 12, sizeof(yoffset));
+                  std::memcpy(&height, args.data() + 20, sizeof(height));
+                  rows.emplace_back(yoffset, height);
+              }
+          });
+        // with a decode pool the chunks are specified as they get decoded
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    }};
+    const std::vector<std::pair<int, int>> expected{{0, 2}, {2, 2}};
+
+    texture_build_stats serial_stats;
+    recorder.clear();
+    test.check(
+      build(nullptr, span_size(chunk.size()), data, serial_stats),
+      "serial built");
+    test.check_equal(serial_stats.upload_count, 2, "serial uploads");
+    test.check_equal(serial_stats.uploaded_size, 4 * 16 * 4, "serial size");
+    test.check_equal(serial_stats.parallel_chunk_count, 0, "serial chunks");
+    test.check(sub_image_rows() == expected, "serial rows");
+
+    texture_build_stats parallel_stats;
+    {
+        resource_decode_pool pool{2};
+        recorder.clear();
+        test.check(
+          build(&pool, span_size(chunk.size()), data, parallel_stats),
+          "parallel built");
+    }
+    test.check_equal(parallel_stats.upload_count, 2, "parallel uploads");
+    test.check_equal(parallel_stats.parallel_chunk_count, 2, "parallel chunks");
+    test.check(sub_image_rows() == expected, "parallel rows");
+
+    // the second chunk is cut short
+    texture_build_stats short_stats;
+    recorder.clear();
+    test.check(
+      not build(
+        nullptr,
+        span_size(chunk.size()),
+        head(data, data.size() - 4),
+        short_stats),
+      "short chunk");
+    test.check_equal(short_stats.upload_count, 1, "first chunk only");
+
+    texture_build_stats empty_stats;
+    recorder.clear();
+    test.check(not build(nullptr, 0, data, empty_stats), "empty");
+    test.check_equal(empty_stats.upload_count, 0, "no uploads");
+}
+//------------------------------------------------------------------------------
+void resources_batch_loader(auto& s) {
+    eagitest::case_ test{s, 15, "texture batch loader"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+
+    // the 128x128 RGB image is added before the 1024x1024 mask
+    texture_batch_loader batch{s.context(), glapi};
+    batch.add(search_resource("SmallTex"), texture_name{1U}, GL.texture_2d)
+      .add(search_resource("LargeTex"), texture_name{2U}, GL.texture_2d);
+    recorder.clear();
+    test.check(batch.load(), "loaded");
+    test.check(batch.succeeded(0), "small loaded");
+    test.check(batch.succeeded(1), "large loaded");
+    test.check_equal(batch.stats().failed_count, 0, "no failures");
+    test.check_equal(
+      batch.stats().uploaded_size, 128 * 128 * 3 + 1024 * 1024, "size");
+
+    // the DSA functions get the texture as the first argument, the others
+    // work with the texture bound by BindTexture(target, texture)
+    gl_types::uint_type bound{0U};
+    const auto texture_of{[&](string_view name, memory::const_block args) {
+        gl_types::uint_type tex{bound};
+        if(name.starts_with("Texture")) {
+            std::memcpy(&tex, args.data(), sizeof(tex));
+        }
+        return tex;
+    }};
+    std::vector<int> storage_pos;
+    std::vector<std::pair<int, gl_types::uint_type>> image_pos;
+    int pos{0};
+    recorder.for_each_command(
+      [&](const gl_command_id id, const memory::const_block args) {
+          const auto name{gl_command_recorder::command_name(id)};
+          if(name == string_view{"BindTexture"}) {
+              std::memcpy(&bound, args.data() + 4, sizeof(bound));
+          } else if(
+            (name == string_view{"TextureStorage2D"}) or
+            (name == string_view{"TexStorage2D"})) {
+              storage_pos.push_back(pos);
+          } else if(
+            (name == string_view{"TextureSubImage2D"}) or
+            (name == string_view{"TexSubImage2D"}) or
+            (name == string_view{"TexImage2D"})) {
+              image_pos.emplace_back(pos, texture_of(name, args));
+          }
+          ++pos;
+      });
+    test.check_equal(storage_pos.size(), 2U, "storage allocated");
+    test.check(not image_pos.empty(), "images specified");
+    if((storage_pos.size() == 2U) and not image_pos.empty()) {
+        test.check(
+          storage_pos.back() < image_pos.front().first, "storage first");
+        test.check_equal(image_pos.front().second, 2U, "largest first");
+        test.check_equal(image_pos.back().second, 1U, "smallest last");
+    }
+}
+//------------------------------------------------------------------------------
+// header values and payload of an eagitex file
+struct texture_file {
+    struct entry {
+        eagine::basic_string_path path;
+        std::vector<std::int64_t> integers;
+        std::vector<std::string> strings;
+    };
+
+    std::vector<entry> entries;
+    std::vector<eagine::byte> payload;
+    std::string data_filter;
+};
+//------------------------------------------------------------------------------
+// reads the header and the still compressed pixel data of an embedded
+// texture resource, through the same parser as the texture builders
+class texture_file_reader
+  : public eagine::valtree::object_builder_impl<texture_file_reader> {
+public:
+    texture_file_reader(texture_file& file) noexcept
+      : _file{file} {}
+
+    template <typename T>
+    void do_add(
+      const eagine::basic_string_path& path,
+      eagine::span<const T> data) noexcept {
+        auto& e{_file.entries.emplace_back()};
+        e.path = path;
+        for(const auto value : data) {
+            e.integers.push_back(std::int64_t(value));
+        }
+    }
+
+    void do_add(
+      const eagine::basic_string_path& path,
+      eagine::span<const eagine::string_view> data) noexcept {
+        if(path.is("data_filter")) {
+            for(const auto value : data) {
+                _file.data_filter.assign(
+                  value.data(), eagine::std_size(value.size()));
+            }
+        } else {
+            auto& e{_file.entries.emplace_back()};
+            e.path = path;
+            for(const auto value : data) {
+                e.strings.emplace_back(
+                  value.data(), eagine::std_size(value.size()));
+            }
+        }
+    }
+
+    auto max_token_size() noexcept -> eagine::span_size_t final {
+        return 64;
+    }
+
+    void unparsed_data(
+      eagine::span<const eagine::memory::const_block> data) noexcept final {
+        for(const auto& blk : data) {
+            _file.payload.insert(_file.payload.end(), blk.begin(), blk.end());
+        }
+    }
+
+    void begin() noexcept final {
+        _file = {};
+        _success = true;
+    }
+
+    auto finish() noexcept -> bool final {
+        return _success;
+    }
+
+    void failed() noexcept final {
+        _success = false;
+    }
+
+private:
+    texture_file& _file;
+    bool _success{false};
+};
+//------------------------------------------------------------------------------
+auto read_texture_file(
+  eagine::main_ctx& ctx,
+  const eagine::embedded_resource& res) -> std::optional<texture_file> {
+    using namespace eagine;
+    texture_file result;
+    if(res.build(
+         ctx,
+         unique_holder<valtree::object_builder>{
+           hold<texture_file_reader>, result})) {
+        return {std::move(result)};
+    }
+    return {};
+}
+//------------------------------------------------------------------------------
+struct decompressed_payload {
+    auto append(const eagine::memory::const_block blk) noexcept -> bool {
+        eagine::memory::append_to(blk, data);
+        return true;
+    }
+
+    eagine::memory::buffer data;
+};
+//------------------------------------------------------------------------------
+auto build_texture_file(
+  const eagine::oglplus::gl_api& glapi,
+  eagine::memory::buffer_pool& buffers,
+  const texture_file& tex,
+  const eagine::string_view data_filter,
+  const eagine::memory::const_block payload,
+  eagine::oglplus::texture_build_stats& stats) -> bool {
+    using namespace eagine;
+    using namespace eagine::oglplus;
+    const auto& GL{glapi.constants()};
+
+    auto builder{make_texture_builder(
+      glapi,
+      buffers,
+      texture_name{1U},
+      GL.texture_2d,
+      {.stats = &stats})};
+    builder->begin();
+    for(const auto& e : tex.entries) {
+        if(not e.integers.empty()) {
+            builder->add(e.path, view(e.integers));
+        }
+        if(not e.strings.empty()) {
+            std::vector<string_view> strings;
+            for(const auto& str : e.strings) {
+                strings.emplace_back(str);
+            }
+            builder->add(e.path, view(strings));
+        }
+    }
+    basic_string_path filter_path;
+    filter_path.push_back("data_filter");
+    const std::array<string_view, 1> filter{data_filter};
+    builder->add(filter_path, view(filter));
+
+    // the resource data is read in blocks, as from a file stream
+    std::vector<memory::const_block> blocks;
+    for(auto rest{payload}; not rest.empty();) {
+        const auto size{std::min(rest.size(), span_size(64 * 1024))};
+        blocks.push_back(head(rest, size));
+        rest = skip(rest, size);
+    }
+    builder->unparsed_data(view(blocks));
+    return builder->finish();
+}
+//------------------------------------------------------------------------------
+void resources_codec_load_time(auto& s) {
+    eagitest::case_ test{s, 12, "texture codec load time"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    memory::buffer_pool buffers;
+
+    for(const auto name : {"TransitTex", "WorleyTex"}) {
+        const auto tex{
+          read_texture_file(s.context(), search_resource(identifier{name}))};
+        test.check(tex.has_value(), "texture file read");
+        if(not tex) {
+            continue;
+        }
+        test.check_equal(tex->data_filter, std::string{"zlib"}, "zlib");
+
+        // the shipped data is zlib-compressed, the uncompressed data
+        // is the same payload with the none filter
+        decompressed_payload raw;
+        {
+            stream_decompression decompression{
+              data_compressor{data_compression_method::zlib, buffers},
+              make_callable_ref<&decompressed_payload::append>(&raw),
+              data_compression_method::zlib};
+            decompression.next(view(tex->payload));
+            decompression.finish();
+        }
+        test.check(not raw.data.empty(), "decompressed");
+
+        const std::array<std::pair<string_view, memory::const_block>, 2>
+          codecs{
+            {{"zlib", view(tex->payload)}, {"none", view(raw.data)}}};
+        for(const auto& [codec, payload] : codecs) {
+            const span_size_t repeats{4};
+            texture_build_stats stats;
+            bool built{true};
+            const auto start{std::chrono::steady_clock::now()};
+            for(const auto r : integer_range(repeats)) {
+                (void)r;
+                built = build_texture_file(
+                          glapi, buffers, *tex, codec, payload, stats) and
+                        built;
+            }
+            const std::chrono::duration<float> elapsed{
+              std::chrono::steady_clock::now() - start};
+            test.check(built, "built");
+            test.check_equal(
+              stats.uploaded_size, raw.data.size(), "uploaded size");
+
+            s.context()
+              .log()
+              .info("texture codec load time")
+              .arg("file", string_view{name})
+              .arg("codec", codec)
+              .arg("inputSize", payload.size())
+              .arg("outputSize", stats.uploaded_size)
+              .arg("perLoad", elapsed.count() / float(repeats))
+              .arg(
+                "MBps",
+                float(stats.uploaded_size * repeats) /
+                  (elapsed.count() * 1024.F * 1024.F));
+        }
+    }
+}
+//------------------------------------------------------------------------------
+auto test_main(eagine::test_ctx& ctx) -> int {
+    eagitest::ctx_suite test{ctx, "resources", 15};
+    test.once(resources_upload_unit_size);
+    test.once(resources_sub_image_layers);
+    test.once(resources_unpack_ring_unmapped);
+    test.once(resources_decode_pool);
+    test.once(resources_async_failed_decode);
+    test.once(resources_batch_throughput);
+    test.once(resources_mipmap_levels);
+    test.once(resources_image_sections);
+    test.once(resources_compressed_image);
+    test.once(resources_texture_builder);
+    test.once(resources_async_unpolled);
+    test.once(resources_codec_load_time);
+    test.once(resources_async_build);
+    test.once(resources_chunked_payload);
+    test.once(resources_batch_loader);
+    return test.exit_code();
+}
+//------------------------------------------------------------------------------
+#include <eagine/testing/unit_end_ctx.hpp>
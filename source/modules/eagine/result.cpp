@@ -10,6 +10,7 @@ module;
 #include "gl_def.hpp"
 
 export module eagine.oglplus:result;
+import std;
 import eagine.core.types;
 import eagine.core.memory;
 import eagine.core.c_api;
@@ -114,6 +115,87 @@ private:
     };
 };
 //------------------------------------------------------------------------------
+/// @brief Enumeration of policies for checking GL errors after wrapped calls.
+/// @ingroup gl_api_wrap
+/// @see gl_api_traits
+/// @see gl_deferred_errors
+export enum class gl_error_check_policy : std::uint8_t {
+    /// @brief GetError is called after every wrapped GL function call.
+    immediate,
+    /// @brief Errors are collected only at explicit flush_errors checkpoints.
+    deferred,
+    /// @brief Same as immediate in debug builds, no error checks in release.
+    disabled_in_release
+};
+//------------------------------------------------------------------------------
+/// @brief Counters of the GL error checking overhead.
+/// @ingroup gl_api_wrap
+/// @see gl_error_check_policy
+export struct gl_error_check_stats {
+    /// @brief The number of wrapped calls that passed through the error check.
+    span_size_t checked_calls{0};
+    /// @brief The number of times GetError was actually invoked.
+    span_size_t get_error_calls{0};
+    /// @brief The number of explicit error flush checkpoints.
+    span_size_t flushes{0};
+};
+//------------------------------------------------------------------------------
+/// @brief GL errors collected at a flush checkpoint with the range of calls.
+/// @ingroup gl_api_wrap
+/// @see gl_error_check_policy
+export class gl_deferred_errors {
+public:
+    constexpr gl_deferred_errors() noexcept = default;
+    constexpr gl_deferred_errors(
+      const span_size_t first_call,
+      const span_size_t end_call) noexcept
+      : _first_call{first_call}
+      , _end_call{end_call} {}
+
+    /// @brief Indicates that there were no errors in the call range.
+    explicit constexpr operator bool() const noexcept {
+        return _count == 0;
+    }
+
+    /// @brief Returns the number of recorded error codes.
+    constexpr auto size() const noexcept -> span_size_t {
+        return _count;
+    }
+
+    /// @brief Returns the recorded error codes.
+    auto error_codes() const noexcept -> span<const gl_types::enum_type> {
+        return head(view(_codes), _count);
+    }
+
+    /// @brief Returns the index of the first wrapped call in the range.
+    constexpr auto first_call() const noexcept -> span_size_t {
+        return _first_call;
+    }
+
+    /// @brief Returns the index past the last wrapped call in the range.
+    constexpr auto end_call() const noexcept -> span_size_t {
+        return _end_call;
+    }
+
+    /// @brief Indicates if more error codes can be recorded.
+    constexpr auto can_add() const noexcept -> bool {
+        return _count < span_size(_codes.size());
+    }
+
+    /// @brief Records an error code.
+    /// @pre can_add()
+    constexpr auto add(const gl_types::enum_type ec) noexcept -> auto& {
+        _codes[std_size(_count++)] = ec;
+        return *this;
+    }
+
+private:
+    std::array<gl_types::enum_type, 8> _codes{};
+    span_size_t _count{0};
+    span_size_t _first_call{0};
+    span_size_t _end_call{0};
+};
+//------------------------------------------------------------------------------
 /// @brief Alias for always-invalid result of a missing GL API function call.
 /// @ingroup gl_api_wrap
 /// @see gl_result
@@ -15,6 +15,7 @@ import eagine.core.types;
 import eagine.core.memory;
 import eagine.core.utility;
 import eagine.core.valid_if;
+import eagine.core.c_api;
 import eagine.shapes;
 import :config;
 import :enum_types;
@@ -64,6 +65,70 @@ export template <typename A>
 auto type_size(const basic_gl_api<A>&, const shapes::index_data_type) noexcept
   -> span_size_t;
 //------------------------------------------------------------------------------
+export class shape_draw_operation;
+export class shape_draw_indirect_batch;
+//------------------------------------------------------------------------------
+/// @brief Shadow copy of the GL state set up by shape draw operations.
+/// @ingroup shapes
+/// @see shape_draw_operation
+/// @see draw_using_instructions
+///
+/// Passed through a sequence of draw operations it allows to skip the state
+/// calls setting values that are already current. If the state is modified
+/// by other code in between draws then invalidate should be called.
+export class shape_draw_state {
+public:
+    /// @brief Returns the number of state calls skipped as redundant.
+    auto skipped_calls() const noexcept -> span_size_t {
+        return _skipped;
+    }
+
+    /// @brief Returns the number of state calls actually issued.
+    auto issued_calls() const noexcept -> span_size_t {
+        return _issued;
+    }
+
+    /// @brief Forgets the cached state values.
+    void invalidate() noexcept {
+        _known = 0U;
+    }
+
+    /// @brief Resets the skipped and issued call counters.
+    void reset_counters() noexcept {
+        _skipped = 0;
+        _issued = 0;
+    }
+
+private:
+    friend class shape_draw_operation;
+
+    static constexpr const std::uint8_t _face_winding_bit{1U << 0U};
+    static constexpr const std::uint8_t _primitive_restart_bit{1U << 1U};
+    static constexpr const std::uint8_t _restart_index_bit{1U << 2U};
+    static constexpr const std::uint8_t _patch_vertices_bit{1U << 3U};
+
+    template <typename T>
+    auto _update(const std::uint8_t bit, T& cached, const T value) noexcept
+      -> bool {
+        if((_known & bit) and (cached == value)) {
+            ++_skipped;
+            return false;
+        }
+        cached = value;
+        _known |= bit;
+        ++_issued;
+        return true;
+    }
+
+    span_size_t _skipped{0};
+    span_size_t _issued{0};
+    gl_types::uint_type _primitive_restart_index{0};
+    gl_types::int_type _patch_vertices{0};
+    std::uint8_t _known{0U};
+    bool _cw_face_winding{false};
+    bool _primitive_restart{false};
+};
+//------------------------------------------------------------------------------
 /// @brief Shape draw operation parameters, translated to GL representation.
 /// @ingroup shapes
 /// @see draw_using_instructions
@@ -99,15 +164,53 @@ public:
 
     /// @brief Invokes the appropriate draw operation on the specified GL api.
     template <typename A>
-    void draw(const basic_gl_api<A>& api) const noexcept;
+    void draw(const basic_gl_api<A>& api, shape_draw_state& state)
+      const noexcept;
+
+    /// @brief Invokes the appropriate draw operation on the specified GL api.
+    template <typename A>
+    void draw(const basic_gl_api<A>& api) const noexcept {
+        shape_draw_state state;
+        draw(api, state);
+    }
+
+    /// @brief Invokes the appropriate instanced draw operation on the given GL api.
+    template <typename A>
+    void draw_instanced(
+      const basic_gl_api<A>& api,
+      const gl_types::sizei_type inst_count,
+      shape_draw_state& state) const noexcept;
 
     /// @brief Invokes the appropriate instanced draw operation on the given GL api.
     template <typename A>
     void draw_instanced(
       const basic_gl_api<A>& api,
-      const gl_types::sizei_type inst_count) const noexcept;
+      const gl_types::sizei_type inst_count) const noexcept {
+        shape_draw_state state;
+        draw_instanced(api, inst_count, state);
+    }
+
+    /// @brief Invokes the draw operation with vertex indices offset by base_vertex.
+    /// @see offset_first
+    template <typename A>
+    void draw_base_vertex(
+      const basic_gl_api<A>& api,
+      const gl_types::int_type base_vertex,
+      shape_draw_state& state) const noexcept;
+
+    /// @brief Invokes the draw operation with vertex indices offset by base_vertex.
+    /// @see offset_first
+    template <typename A>
+    void draw_base_vertex(
+      const basic_gl_api<A>& api,
+      const gl_types::int_type base_vertex) const noexcept {
+        shape_draw_state state;
+        draw_base_vertex(api, base_vertex, state);
+    }
 
 private:
+    friend class shape_draw_indirect_batch;
+
     primitive_type _mode{0};
     index_data_type _idx_type{0};
     gl_types::int_type _first{0};
@@ -121,7 +224,19 @@ private:
     auto _idx_ptr() const noexcept -> gl_types::const_void_ptr_type;
 
     template <typename A>
-    void _prepare(const basic_gl_api<A>& api) const noexcept;
+    void _prepare(const basic_gl_api<A>& api, shape_draw_state& state)
+      const noexcept;
+
+    template <typename A>
+    auto _idx_size(const basic_gl_api<A>& api) const noexcept -> span_size_t;
+
+    auto _same_state(const shape_draw_operation& that) const noexcept -> bool {
+        return (_mode == that._mode) and (_idx_type == that._idx_type) and
+               (_primitive_restart == that._primitive_restart) and
+               (_primitive_restart_index == that._primitive_restart_index) and
+               (_patch_vertices == that._patch_vertices) and
+               (_cw_face_winding == that._cw_face_winding);
+    }
 };
 //------------------------------------------------------------------------------
 /// @brief Holds the first index and count of a subset of drawn shape elements.
@@ -307,34 +422,71 @@ auto shape_draw_operation::_idx_ptr() const noexcept
 }
 //------------------------------------------------------------------------------
 template <typename A>
-void shape_draw_operation::_prepare(const basic_gl_api<A>& api) const noexcept {
+void shape_draw_operation::_prepare(
+  const basic_gl_api<A>& api,
+  shape_draw_state& state) const noexcept {
     auto& [gl, GL] = api;
 
-    if(_cw_face_winding) {
-        gl.front_face(GL.cw);
-    } else {
-        gl.front_face(GL.ccw);
+    if(state._update(
+         state._face_winding_bit, state._cw_face_winding, _cw_face_winding)) {
+        if(_cw_face_winding) {
+            gl.front_face(GL.cw);
+        } else {
+            gl.front_face(GL.ccw);
+        }
     }
 
     if(GL.primitive_restart) {
+        if(state._update(
+             state._primitive_restart_bit,
+             state._primitive_restart,
+             _primitive_restart)) {
+            if(_primitive_restart) {
+                gl.enable(GL.primitive_restart);
+            } else {
+                gl.disable(GL.primitive_restart);
+            }
+        }
         if(_primitive_restart) {
-            gl.enable(GL.primitive_restart);
-            gl.primitive_restart_index(_primitive_restart_index);
-        } else {
-            gl.disable(GL.primitive_restart);
+            if(state._update(
+                 state._restart_index_bit,
+                 state._primitive_restart_index,
+                 _primitive_restart_index)) {
+                gl.primitive_restart_index(_primitive_restart_index);
+            }
         }
     }
 
     if(GL.patches) {
         if(_mode == GL.patches) {
-            gl.patch_parameter_i(GL.patch_vertices, _patch_vertices);
+            if(state._update(
+                 state._patch_vertices_bit,
+                 state._patch_vertices,
+                 _patch_vertices)) {
+                gl.patch_parameter_i(GL.patch_vertices, _patch_vertices);
+            }
         }
     }
 }
 //------------------------------------------------------------------------------
 template <typename A>
-void shape_draw_operation::draw(const basic_gl_api<A>& api) const noexcept {
-    _prepare(api);
+auto shape_draw_operation::_idx_size(const basic_gl_api<A>& api) const noexcept
+  -> span_size_t {
+    auto& GL = api.constants();
+    if(_idx_type == GL.unsigned_int_) {
+        return span_size(sizeof(gl_types::uint_type));
+    }
+    if(_idx_type == GL.unsigned_short_) {
+        return span_size(sizeof(gl_types::ushort_type));
+    }
+    return span_size(sizeof(gl_types::ubyte_type));
+}
+//------------------------------------------------------------------------------
+template <typename A>
+void shape_draw_operation::draw(
+  const basic_gl_api<A>& api,
+  shape_draw_state& state) const noexcept {
+    _prepare(api, state);
     auto& [gl, GL] = api;
 
     if(is_indexed(api)) {
@@ -347,8 +499,9 @@ void shape_draw_operation::draw(const basic_gl_api<A>& api) const noexcept {
 template <typename A>
 void shape_draw_operation::draw_instanced(
   const basic_gl_api<A>& api,
-  const gl_types::sizei_type inst_count) const noexcept {
-    _prepare(api);
+  const gl_types::sizei_type inst_count,
+  shape_draw_state& state) const noexcept {
+    _prepare(api, state);
     auto& [gl, GL] = api;
 
     if(is_indexed(api)) {
@@ -359,33 +512,69 @@ void shape_draw_operation::draw_instanced(
     }
 }
 //------------------------------------------------------------------------------
+template <typename A>
+void shape_draw_operation::draw_base_vertex(
+  const basic_gl_api<A>& api,
+  const gl_types::int_type base_vertex,
+  shape_draw_state& state) const noexcept {
+    _prepare(api, state);
+    auto& [gl, GL] = api;
+
+    if(is_indexed(api)) {
+        gl.draw_elements_base_vertex(
+          _mode, _count, _idx_type, _idx_ptr(), base_vertex);
+    } else {
+        gl.draw_arrays(_mode, _first + base_vertex, _count);
+    }
+}
+//------------------------------------------------------------------------------
 export template <typename A>
 void draw_using_instructions(
   const basic_gl_api<A>& api,
-  const span<const shape_draw_operation> ops) noexcept {
+  const span<const shape_draw_operation> ops,
+  shape_draw_state& state) noexcept {
     for(const auto& op : ops) {
-        op.draw(api);
+        op.draw(api, state);
     }
 }
 //------------------------------------------------------------------------------
 export template <typename A>
+void draw_using_instructions(
+  const basic_gl_api<A>& api,
+  const span<const shape_draw_operation> ops) noexcept {
+    shape_draw_state state;
+    draw_using_instructions(api, ops, state);
+}
+//------------------------------------------------------------------------------
+export template <typename A>
 void draw_instanced_using_instructions(
   const basic_gl_api<A>& api,
   const span<const shape_draw_operation> ops,
-  const gl_types::sizei_type inst_count) noexcept {
+  const gl_types::sizei_type inst_count,
+  shape_draw_state& state) noexcept {
     for(const auto& op : ops) {
-        op.draw_instanced(api, inst_count);
+        op.draw_instanced(api, inst_count, state);
     }
 }
 //------------------------------------------------------------------------------
 export template <typename A>
+void draw_instanced_using_instructions(
+  const basic_gl_api<A>& api,
+  const span<const shape_draw_operation> ops,
+  const gl_types::sizei_type inst_count) noexcept {
+    shape_draw_state state;
+    draw_instanced_using_instructions(api, ops, inst_count, state);
+}
+//------------------------------------------------------------------------------
+export template <typename A>
 void draw_using_instructions(
   const basic_gl_api<A>& api,
   const span<const shape_draw_operation> ops,
   const shape_draw_subset& subs) noexcept {
+    shape_draw_state state;
     for(const auto i : integer_range(subs.first, subs.first + subs.count)) {
         if(i < ops.size()) [[likely]] {
-            ops[i].draw(api);
+            ops[i].draw(api, state);
         }
     }
 }
@@ -396,13 +585,277 @@ void draw_using_instructions(
   const span<const shape_draw_operation> ops,
   const shape_draw_subset& subs,
   const gl_types::sizei_type inst_count) noexcept {
+    shape_draw_state state;
     for(const auto i : integer_range(subs.first, subs.first + subs.count)) {
         if(i < ops.size()) [[likely]] {
-            ops[i].draw_instanced(api, inst_count);
+            ops[i].draw_instanced(api, inst_count, state);
+        }
+    }
+}
+//------------------------------------------------------------------------------
+/// @brief Layout of the indirect indexed draw command used by GL.
+/// @ingroup shapes
+/// @see shape_draw_indirect_batch
+export struct draw_elements_indirect_command {
+    gl_types::uint_type count{0};
+    gl_types::uint_type instance_count{1};
+    gl_types::uint_type first_index{0};
+    gl_types::int_type base_vertex{0};
+    gl_types::uint_type base_instance{0};
+};
+//------------------------------------------------------------------------------
+/// @brief Layout of the indirect non-indexed draw command used by GL.
+/// @ingroup shapes
+/// @see shape_draw_indirect_batch
+export struct draw_arrays_indirect_command {
+    gl_types::uint_type count{0};
+    gl_types::uint_type instance_count{1};
+    gl_types::uint_type first{0};
+    gl_types::uint_type base_instance{0};
+};
+//------------------------------------------------------------------------------
+/// @brief Compiles shape draw operations into multi-draw-indirect commands.
+/// @ingroup shapes
+/// @see shape_draw_operation
+/// @see draw_using_instructions
+///
+/// Operations from many geometries are grouped by drawing phase, primitive
+/// mode, index type and the rest of the drawing state, so each group is
+/// submitted with a single multi_draw_elements_indirect or
+/// multi_draw_arrays_indirect call and the state is set up once per group
+/// instead of once per operation. The groups are submitted in the order
+/// of the drawing phases.
+/// All added geometries must share the vertex array bound during submission,
+/// for example the geometries from the same geometry_arena pool.
+export class shape_draw_indirect_batch {
+public:
+    /// @brief Adds the specified operations, with optional base vertex and instancing.
+    template <typename A>
+    void add(
+      const basic_gl_api<A>& api,
+      const span<const shape_draw_operation> ops,
+      const gl_types::int_type base_vertex = 0,
+      const gl_types::sizei_type inst_count = 1,
+      const gl_types::uint_type base_instance = 0);
+
+    /// @brief Returns the number of state groups (and multi-draw calls).
+    auto group_count() const noexcept -> span_size_t {
+        return span_size(_groups.size());
+    }
+
+    /// @brief Returns the total number of compiled draw commands.
+    auto command_count() const noexcept -> span_size_t {
+        span_size_t result{0};
+        for(const auto& grp : _groups) {
+            result += span_size(grp.elements.size() + grp.arrays.size());
+        }
+        return result;
+    }
+
+    /// @brief Packs the commands into a block and uploads them into a buffer.
+    /// @see submit
+    template <typename A>
+    void upload(const basic_gl_api<A>& api, const buffer_name buf);
+
+    /// @brief Issues the uploaded commands from the specified buffer.
+    /// @see upload
+    /// @pre upload was called after the last add
+    template <typename A>
+    void submit(const basic_gl_api<A>& api, const buffer_name buf) const;
+
+    /// @brief Removes all compiled commands.
+    void clear() noexcept {
+        _groups.clear();
+        _data.clear();
+    }
+
+private:
+    struct group {
+        shape_draw_operation state;
+        std::vector<draw_elements_indirect_command> elements;
+        std::vector<draw_arrays_indirect_command> arrays;
+        span_size_t offset{0};
+    };
+
+    auto _group_of(const shape_draw_operation& op) -> group&;
+
+    std::vector<group> _groups;
+    std::vector<byte> _data;
+};
+//------------------------------------------------------------------------------
+inline auto shape_draw_indirect_batch::_group_of(const shape_draw_operation& op)
+  -> group& {
+    // operations are merged only within the same drawing phase and
+    // the groups are kept sorted by phase, so that submit does not draw
+    // the operations of a later phase before those of an earlier one
+    auto pos{_groups.begin()};
+    for(; pos != _groups.end(); ++pos) {
+        if(pos->state._phase > op._phase) {
+            break;
+        }
+        if((pos->state._phase == op._phase) and pos->state._same_state(op)) {
+            return *pos;
         }
     }
+    return *_groups.insert(pos, group{.state = op});
 }
 //------------------------------------------------------------------------------
+template <typename A>
+void shape_draw_indirect_batch::add(
+  const basic_gl_api<A>& api,
+  const span<const shape_draw_operation> ops,
+  const gl_types::int_type base_vertex,
+  const gl_types::sizei_type inst_count,
+  const gl_types::uint_type base_instance) {
+    for(const auto& op : ops) {
+        auto& grp{_group_of(op)};
+        if(op.is_indexed(api)) {
+            grp.elements.push_back(
+              {.count = gl_types::uint_type(op._count),
+               .instance_count = gl_types::uint_type(inst_count),
+               .first_index =
+                 gl_types::uint_type(op._first / op._idx_size(api)),
+               .base_vertex = base_vertex,
+               .base_instance = base_instance});
+        } else {
+            grp.arrays.push_back(
+              {.count = gl_types::uint_type(op._count),
+               .instance_count = gl_types::uint_type(inst_count),
+               .first = gl_types::uint_type(op._first + base_vertex),
+               .base_instance = base_instance});
+        }
+    }
+}
+//------------------------------------------------------------------------------
+template <typename A>
+void shape_draw_indirect_batch::upload(
+  const basic_gl_api<A>& api,
+  const buffer_name buf) {
+    auto& [gl, GL] = api;
+
+    const auto append{[this](const auto& commands) {
+        const auto size{commands.size() * sizeof(commands.front())};
+        const auto offset{_data.size()};
+        _data.resize(offset + size);
+        std::memcpy(_data.data() + offset, commands.data(), size);
+    }};
+
+    _data.clear();
+    for(auto& grp : _groups) {
+        grp.offset = span_size(_data.size());
+        if(not grp.elements.empty()) {
+            append(grp.elements);
+        } else if(not grp.arrays.empty()) {
+            append(grp.arrays);
+        }
+    }
+
+    gl.bind_buffer(GL.draw_indirect_buffer, buf);
+    gl.buffer_data(GL.draw_indirect_buffer, view(_data), GL.dynamic_draw);
+}
+//------------------------------------------------------------------------------
+template <typename A>
+void shape_draw_indirect_batch::submit(
+  const basic_gl_api<A>& api,
+  const buffer_name buf) const {
+    auto& [gl, GL] = api;
+    gl.bind_buffer(GL.draw_indirect_buffer, buf);
+
+    shape_draw_state state;
+    for(const auto& grp : _groups) {
+        grp.state._prepare(api, state);
+        const auto& op{grp.state};
+        const auto ptr{
+          eagine::memory::typed_nullptr<const gl_types::ubyte_type> +
+          grp.offset};
+        if(not grp.elements.empty()) {
+            const auto count{limit_cast<gl_types::sizei_type>(
+              grp.elements.size())};
+            if(gl.multi_draw_elements_indirect) {
+                gl.multi_draw_elements_indirect(
+                  op._mode, op._idx_type, ptr, count, 0);
+            } else {
+                for(const auto i : integer_range(count)) {
+                    gl.draw_elements_indirect(
+                      op._mode,
+                      op._idx_type,
+                      ptr + i * sizeof(draw_elements_indirect_command));
+                }
+            }
+        } else if(not grp.arrays.empty()) {
+            const auto count{
+              limit_cast<gl_types::sizei_type>(grp.arrays.size())};
+            if(gl.multi_draw_arrays_indirect) {
+                gl.multi_draw_arrays_indirect(op._mode, ptr, count, 0);
+            } else {
+                for(const auto i : integer_range(count)) {
+                    gl.draw_arrays_indirect(
+                      op._mode,
+                      ptr + i * sizeof(draw_arrays_indirect_command));
+                }
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------
+/// @brief Uploads static data into the specified buffer.
+/// @ingroup shapes
+///
+/// Uses immutable storage (named_buffer_storage or buffer_storage) if the
+/// functions are available, otherwise falls back to buffer_data with
+/// static_draw usage. The buffer must be bound to the target if DSA
+/// is not supported and must not have had its storage specified before.
+template <typename A>
+void static_buffer_data(
+  const basic_gl_api<A>& api,
+  const buffer_target target,
+  const buffer_name buf,
+  const memory::const_block data) {
+    auto& [gl, GL] = api;
+    const c_api::enum_bitfield<buffer_storage_bit> immutable{};
+    if(gl.named_buffer_storage) {
+        gl.named_buffer_storage(
+          buf,
+          limit_cast<gl_types::sizeiptr_type>(data.size()),
+          data.data(),
+          immutable);
+    } else if(gl.buffer_storage) {
+        gl.buffer_storage(
+          target,
+          limit_cast<gl_types::sizeiptr_type>(data.size()),
+          data.data(),
+          immutable);
+    } else {
+        gl.buffer_data(target, data, GL.static_draw);
+    }
+}
+//------------------------------------------------------------------------------
+export class vertex_attrib_bindings;
+//------------------------------------------------------------------------------
+/// @brief Layout of vertex attributes packed into a single interleaved buffer.
+/// @ingroup shapes
+/// @see shape_generator::interleaved_layout
+/// @see vertex_buffer_layout
+export struct interleaved_attrib_layout {
+    /// @brief Byte offsets of the attributes, in the order of the bindings.
+    std::vector<span_size_t> offsets;
+    /// @brief The distance in bytes between consecutive vertices.
+    span_size_t stride{0};
+    /// @brief The number of packed vertices.
+    span_size_t vertex_count{0};
+    /// @brief The size of the largest single-attribute data block.
+    span_size_t scratch_size{0};
+    /// @brief The instancing divisor shared by all attributes.
+    span_size_t divisor{0};
+    /// @brief Indicates if all attributes have the same instancing divisor.
+    bool uniform_divisor{true};
+
+    /// @brief Returns the size of the interleaved data block.
+    auto data_size() const noexcept -> span_size_t {
+        return stride * vertex_count;
+    }
+};
+//------------------------------------------------------------------------------
 /// @brief Class wrapping a generic shape loader/generator, adapting it for GL.
 /// @ingroup shapes
 /// @see shapes::generator
@@ -588,6 +1041,32 @@ public:
         return attrib_setup(api, vao, buf, loc, attrib_variant, {}, temp);
     }
 
+    /// @brief Computes the layout of the bound attributes in an interleaved buffer.
+    /// @see interleaved_attrib_data
+    auto interleaved_layout(const vertex_attrib_bindings& bindings) const
+      -> interleaved_attrib_layout;
+
+    /// @brief Packs the bound attributes into the interleaved data block.
+    /// @see interleaved_layout
+    /// @pre dest.size() >= layout.data_size()
+    /// @pre scratch.size() >= layout.scratch_size
+    void interleaved_attrib_data(
+      const vertex_attrib_bindings& bindings,
+      const interleaved_attrib_layout& layout,
+      memory::block dest,
+      memory::block scratch) const;
+
+    /// @brief Uploads and sets up all bound attributes in a single buffer.
+    /// @see interleaved_layout
+    template <typename A>
+    void interleaved_attrib_setup(
+      const basic_gl_api<A>& api,
+      const vertex_array_name vao,
+      const buffer_name buf,
+      const vertex_attrib_bindings& bindings,
+      const string_view label,
+      memory::buffer& temp) const;
+
     template <typename A>
     void index_setup(
       const basic_gl_api<A>& api,
@@ -715,7 +1194,7 @@ void shape_generator::attrib_setup(
     if(label) {
         gl.object_label(buf, label);
     }
-    gl.buffer_data(GL.array_buffer, data, GL.static_draw);
+    static_buffer_data(api, GL.array_buffer, buf, data);
 
     const auto is_integral{is_attrib_integral(vav)};
     const auto is_normalized{is_attrib_normalized(api, vav)};
@@ -771,7 +1250,7 @@ inline void shape_generator::index_setup(
     if(label) {
         gl.object_label(buf, label);
     }
-    gl.buffer_data(GL.element_array_buffer, data, GL.static_draw);
+    static_buffer_data(api, GL.element_array_buffer, buf, data);
 }
 //------------------------------------------------------------------------------
 template <typename A>
@@ -783,7 +1262,6 @@ void shape_generator::index_setup(
   memory::buffer& temp) const {
     auto& [gl, GL] = api;
 
-    // TODO: buffer_storage + buffer_sub_data if available
     span_size_t total_size = 0;
     for(auto dv : dvs) {
         const auto size = index_data_block_size(dv);
@@ -799,7 +1277,7 @@ void shape_generator::index_setup(
     if(label) {
         gl.object_label(buf, label);
     }
-    gl.buffer_data(GL.element_array_buffer, data, GL.static_draw);
+    static_buffer_data(api, GL.element_array_buffer, buf, data);
 }
 //------------------------------------------------------------------------------
 template <typename A>
@@ -1156,6 +1634,107 @@ private:
     shared_holder<vertex_attrib_binding_intf> _pimpl;
 };
 //------------------------------------------------------------------------------
+template <typename A>
+void shape_generator::interleaved_attrib_setup(
+  const basic_gl_api<A>& api,
+  const vertex_array_name vao,
+  const buffer_name buf,
+  const vertex_attrib_bindings& bindings,
+  const string_view label,
+  memory::buffer& temp) const {
+    auto& [gl, GL] = api;
+
+    const auto layout{interleaved_layout(bindings)};
+    const auto size{layout.data_size()};
+    auto block{cover(temp.ensure(size + layout.scratch_size))};
+    auto data{head(block, size)};
+    interleaved_attrib_data(bindings, layout, data, skip(block, size));
+
+    const bool use_dsa{
+      gl.vertex_array_vertex_buffer and gl.vertex_array_attrib_format and
+      gl.vertex_array_attrib_iformat and gl.vertex_array_attrib_binding and
+      gl.enable_vertex_array_attrib and layout.uniform_divisor};
+
+    gl.bind_buffer(GL.array_buffer, buf);
+    if(label) {
+        gl.object_label(buf, label);
+    }
+    static_buffer_data(api, GL.array_buffer, buf, data);
+
+    const auto stride{limit_cast<gl_types::sizei_type>(layout.stride)};
+    if(use_dsa) {
+        gl.vertex_array_vertex_buffer(vao, 0U, buf, 0, stride);
+        if(gl.vertex_array_binding_divisor) {
+            gl.vertex_array_binding_divisor(
+              vao, 0U, limit_cast<gl_types::uint_type>(layout.divisor));
+        }
+    }
+
+    for(const auto i : integer_range(bindings.attrib_count())) {
+        const auto vav{bindings.attrib_variant(i)};
+        const auto loc{bindings.location(vav)};
+        const auto offset{layout.offsets[std_size(i)]};
+        const auto value_count{
+          limit_cast<gl_types::int_type>(values_per_vertex(vav))};
+        const auto is_integral{is_attrib_integral(vav)};
+        const auto is_normalized{is_attrib_normalized(api, vav)};
+
+        if(use_dsa) {
+            const auto rel_offset{limit_cast<gl_types::uint_type>(offset)};
+            if(is_integral and not is_normalized) [[unlikely]] {
+                gl.vertex_array_attrib_iformat(
+                  vao, loc, value_count, attrib_type(api, vav), rel_offset);
+            } else {
+                gl.vertex_array_attrib_format(
+                  vao,
+                  loc,
+                  value_count,
+                  attrib_type(api, vav),
+                  is_normalized,
+                  rel_offset);
+            }
+            gl.vertex_array_attrib_binding(vao, loc, 0U);
+            gl.enable_vertex_array_attrib(vao, loc);
+        } else {
+            const auto ptr{reinterpret_cast<const void*>(
+              static_cast<std::intptr_t>(offset))};
+            if(is_integral and not is_normalized) [[unlikely]] {
+                gl.vertex_attrib_ipointer(
+                  loc, value_count, attrib_type(api, vav), stride, ptr);
+            } else {
+                gl.vertex_attrib_pointer(
+                  loc,
+                  value_count,
+                  attrib_type(api, vav),
+                  is_normalized,
+                  stride,
+                  ptr);
+            }
+            if(attrib_divisors()) {
+                gl.vertex_attrib_divisor(
+                  loc, limit_cast<gl_types::uint_type>(attrib_divisor(vav)));
+            } else {
+                gl.vertex_attrib_divisor(loc, 0U);
+            }
+            if(gl.enable_vertex_array_attrib) {
+                gl.enable_vertex_array_attrib(vao, loc);
+            } else {
+                gl.enable_vertex_attrib_array(loc);
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------
+/// @brief Enumeration of vertex buffer layouts used by geometry.
+/// @ingroup shapes
+/// @see geometry
+export enum class vertex_buffer_layout : std::uint8_t {
+    /// @brief Each attribute is stored in a separate buffer.
+    separate,
+    /// @brief All attributes are packed into a single interleaved buffer.
+    interleaved
+};
+//------------------------------------------------------------------------------
 /// @brief Class wrapping a vertex attribute array and buffers storing shape geometry.
 /// @see generator
 /// @see vertex_attrib_bindings
@@ -1176,8 +1755,24 @@ public:
       const shape_generator& shape,
       const vertex_attrib_bindings& bindings,
       const shapes::drawing_variant var,
+      const vertex_buffer_layout layout,
       memory::buffer& temp);
 
+    /// @brief Construction using shape generator, attrib bindings and drawing variant.
+    geometry(
+      const gl_api& glapi,
+      const shape_generator& shape,
+      const vertex_attrib_bindings& bindings,
+      const shapes::drawing_variant var,
+      memory::buffer& temp)
+      : geometry{
+          glapi,
+          shape,
+          bindings,
+          var,
+          vertex_buffer_layout::separate,
+          temp} {}
+
     /// @brief Construction using shape generator and attrib bindings.
     geometry(
       const gl_api& glapi,
@@ -1217,6 +1812,17 @@ public:
           glapi, view(_ops), limit_cast<gl_types::sizei_type>(_instance_count));
     }
 
+    /// @brief Emits geometry draw commands skipping redundant state changes.
+    /// @see use
+    /// @see shape_draw_state
+    auto draw(const gl_api& glapi, shape_draw_state& state) const {
+        draw_instanced_using_instructions(
+          glapi,
+          view(_ops),
+          limit_cast<gl_types::sizei_type>(_instance_count),
+          state);
+    }
+
     /// @brief Emits geometry draw commands using the specified GL API.
     /// @see use
     /// @see draw
@@ -1256,6 +1862,16 @@ public:
       : vertex_attrib_bindings{bindings}
       , geometry{glapi, shape, bindings, var, temp} {}
 
+    geometry_and_bindings(
+      const gl_api& glapi,
+      const shape_generator& shape,
+      const vertex_attrib_bindings& bindings,
+      const shapes::drawing_variant var,
+      const vertex_buffer_layout layout,
+      memory::buffer& temp)
+      : vertex_attrib_bindings{bindings}
+      , geometry{glapi, shape, bindings, var, layout, temp} {}
+
     geometry_and_bindings(
       const gl_api& glapi,
       const shape_generator& shape,
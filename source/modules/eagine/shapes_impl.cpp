@@ -85,6 +85,63 @@ void shape_generator::index_data(
     }
 }
 //------------------------------------------------------------------------------
+auto shape_generator::interleaved_layout(
+  const vertex_attrib_bindings& bindings) const -> interleaved_attrib_layout {
+    // keep each attribute 4-byte aligned as recommended by the GL spec
+    const auto align{[](span_size_t size) {
+        return (size + 3) / 4 * 4;
+    }};
+    interleaved_attrib_layout result;
+    const auto attrib_count{bindings.attrib_count()};
+    result.offsets.reserve(std_size(attrib_count));
+    result.vertex_count = vertex_count();
+
+    for(const auto i : integer_range(attrib_count)) {
+        const auto vav{bindings.attrib_variant(i)};
+        result.offsets.push_back(result.stride);
+        result.stride += align(values_per_vertex(vav) * attrib_type_size(vav));
+        result.scratch_size =
+          std::max(result.scratch_size, attrib_data_block_size(vav));
+
+        const auto divisor{
+          attrib_divisors() ? span_size(attrib_divisor(vav)) : span_size_t(0)};
+        if(i == 0) {
+            result.divisor = divisor;
+        } else if(result.divisor != divisor) {
+            result.uniform_divisor = false;
+        }
+    }
+    return result;
+}
+//------------------------------------------------------------------------------
+void shape_generator::interleaved_attrib_data(
+  const vertex_attrib_bindings& bindings,
+  const interleaved_attrib_layout& layout,
+  memory::block dest,
+  memory::block scratch) const {
+    assert(dest.size() >= layout.data_size());
+    // zero the alignment padding between attributes
+    std::memset(dest.data(), 0, std_size(layout.data_size()));
+
+    for(const auto i : integer_range(bindings.attrib_count())) {
+        const auto vav{bindings.attrib_variant(i)};
+        const auto size{attrib_data_block_size(vav)};
+        assert(scratch.size() >= size);
+        auto src{head(scratch, size)};
+        attrib_data(vav, src);
+
+        const auto elem_size{
+          std_size(values_per_vertex(vav) * attrib_type_size(vav))};
+        auto* dst{dest.data() + layout.offsets[std_size(i)]};
+        const auto* ptr{src.data()};
+        for(span_size_t v = 0; v < layout.vertex_count; ++v) {
+            std::memcpy(dst, ptr, elem_size);
+            dst += layout.stride;
+            ptr += elem_size;
+        }
+    }
+}
+//------------------------------------------------------------------------------
 // default_vertex_attrib_bindings
 //------------------------------------------------------------------------------
 class default_vertex_attrib_bindings : public vertex_attrib_binding_intf {
@@ -306,13 +363,17 @@ geometry::geometry(
   const shape_generator& shape,
   const vertex_attrib_bindings& bindings,
   const shapes::drawing_variant var,
+  const vertex_buffer_layout layout,
   memory::buffer& temp)
   : _instance_count{shape.instance_count()} {
 
     const auto& gl = glapi.operations();
     gl.gen_vertex_arrays() >> _vao;
     const auto attrib_count{bindings.attrib_count()};
-    auto buffer_count{attrib_count};
+    const bool interleaved{
+      (layout == vertex_buffer_layout::interleaved) and (attrib_count > 0)};
+    const auto vertex_buffer_count{interleaved ? 1 : attrib_count};
+    auto buffer_count{vertex_buffer_count};
 
     _ops.resize(integer(shape.operation_count(var)));
     shape.instructions(glapi, var, cover(_ops));
@@ -327,13 +388,18 @@ geometry::geometry(
 
     gl.bind_vertex_array(_vao);
 
-    for(const integer i : integer_range(attrib_count)) {
-        const auto vav{bindings.attrib_variant(i)};
-        const auto loc{bindings.location(vav)};
-        shape.attrib_setup(glapi, _vao, _buffers[i], loc, vav, temp);
+    if(interleaved) {
+        shape.interleaved_attrib_setup(
+          glapi, _vao, _buffers[0], bindings, {}, temp);
+    } else {
+        for(const integer i : integer_range(attrib_count)) {
+            const auto vav{bindings.attrib_variant(i)};
+            const auto loc{bindings.location(vav)};
+            shape.attrib_setup(glapi, _vao, _buffers[i], loc, vav, temp);
+        }
     }
     if(indexed) {
-        shape.index_setup(glapi, _buffers[attrib_count], temp);
+        shape.index_setup(glapi, _buffers[vertex_buffer_count], temp);
     }
 }
 //------------------------------------------------------------------------------
@@ -0,0 +1,375 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+
+#include <eagine/testing/unit_begin_ctx.hpp>
+import std;
+import eagine.core;
+import eagine.shapes;
+import eagine.oglplus;
+//------------------------------------------------------------------------------
+namespace {
+// the recorder stores the call arguments packed, without padding
+template <typename T>
+auto recorded_arg(eagine::memory::const_block args, std::size_t offs) -> T {
+    T result{};
+    std::memcpy(&result, args.data() + offs, sizeof(T));
+    return result;
+}
+//------------------------------------------------------------------------------
+} // namespace
+//------------------------------------------------------------------------------
+void shapes_interleaved_layout(auto& s) {
+    eagitest::case_ test{s, 1, "interleaved layout"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    const gl_api glapi{s.context()};
+    const vertex_attrib_bindings bindings{
+      shapes::vertex_attrib_kind::position,
+      shapes::vertex_attrib_kind::normal,
+      shapes::vertex_attrib_kind::wrap_coord};
+    const shape_generator shape{
+      glapi, shapes::unit_twisted_torus(bindings.attrib_kinds(), 6, 48, 4, 0.5F)};
+
+    const auto layout{shape.interleaved_layout(bindings)};
+    test.check_equal(
+      layout.offsets.size(), std::size_t(bindings.attrib_count()), "count");
+    test.check_equal(layout.vertex_count, shape.vertex_count(), "vertices");
+
+    span_size_t stride{0};
+    for(const auto i : integer_range(bindings.attrib_count())) {
+        const auto vav{bindings.attrib_variant(i)};
+        test.check_equal(layout.offsets[std_size(i)], stride, "offset");
+        test.check_equal(layout.offsets[std_size(i)] % 4, 0, "aligned");
+        stride += shape.values_per_vertex(vav) * shape.attrib_type_size(vav);
+    }
+    test.check_equal(layout.stride, stride, "stride");
+    test.check_equal(
+      layout.data_size(), stride * shape.vertex_count(), "data size");
+}
+//------------------------------------------------------------------------------
+void shapes_interleaved_packing(auto& s) {
+    eagitest::case_ test{s, 2, "interleaved packing"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    const gl_api glapi{s.context()};
+    const vertex_attrib_bindings bindings{
+      shapes::vertex_attrib_kind::position,
+      shapes::vertex_attrib_kind::normal,
+      shapes::vertex_attrib_kind::wrap_coord};
+    const shape_generator shape{
+      glapi, shapes::unit_twisted_torus(bindings.attrib_kinds(), 6, 48, 4, 0.5F)};
+
+    const auto layout{shape.interleaved_layout(bindings)};
+    std::vector<byte> packed(std_size(layout.data_size()));
+    std::vector<byte> scratch(std_size(layout.scratch_size));
+    shape.interleaved_attrib_data(
+      bindings, layout, cover(packed), cover(scratch));
+
+    for(const auto i : integer_range(bindings.attrib_count())) {
+        const auto vav{bindings.attrib_variant(i)};
+        const auto elem_size{
+          shape.values_per_vertex(vav) * shape.attrib_type_size(vav)};
+        std::vector<byte> separate(std_size(shape.attrib_data_block_size(vav)));
+        shape.attrib_data(vav, cover(separate));
+
+        for(span_size_t v = 0; v < layout.vertex_count; ++v) {
+            const auto packed_pos{
+              std_size(layout.offsets[std_size(i)] + v * layout.stride)};
+            const auto separate_pos{std_size(v * elem_size)};
+            test.check(
+              std::equal(
+                separate.begin() + separate_pos,
+                separate.begin() + separate_pos + std_size(elem_size),
+                packed.begin() + packed_pos),
+              "same data");
+        }
+    }
+}
+//------------------------------------------------------------------------------
+void shapes_interleaved_packing_time(auto& s) {
+    eagitest::case_ test{s, 3, "interleaved packing time"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    const gl_api glapi{s.context()};
+    const vertex_attrib_bindings bindings{
+      shapes::vertex_attrib_kind::position,
+      shapes::vertex_attrib_kind::normal,
+      shapes::vertex_attrib_kind::tangent,
+      shapes::vertex_attrib_kind::wrap_coord};
+    const shape_generator shape{
+      glapi,
+      shapes::unit_twisted_torus(bindings.attrib_kinds(), 6, 384, 96, 0.5F)};
+
+    const std::size_t repeats{8U};
+    memory::buffer temp;
+
+    const auto separate_start{std::chrono::steady_clock::now()};
+    for(std::size_t r = 0; r < repeats; ++r) {
+        for(const auto i : integer_range(bindings.attrib_count())) {
+            const auto vav{bindings.attrib_variant(i)};
+            const auto size{shape.attrib_data_block_size(vav)};
+            shape.attrib_data(vav, head(cover(temp.ensure(size)), size));
+        }
+    }
+    const std::chrono::duration<float, std::milli> separate{
+      std::chrono::steady_clock::now() - separate_start};
+
+    const auto layout{shape.interleaved_layout(bindings)};
+    const auto size{layout.data_size()};
+    const auto interleaved_start{std::chrono::steady_clock::now()};
+    for(std::size_t r = 0; r < repeats; ++r) {
+        auto block{cover(temp.ensure(size + layout.scratch_size))};
+        shape.interleaved_attrib_data(
+          bindings, layout, head(block, size), skip(block, size));
+    }
+    const std::chrono::duration<float, std::milli> interleaved{
+      std::chrono::steady_clock::now() - interleaved_start};
+
+    s.context()
+      .log()
+      .info("interleaved packing time")
+      .arg("vertices", shape.vertex_count())
+      .arg("stride", layout.stride)
+      .arg("separate", separate.count() / float(repeats))
+      .arg("interleaved", interleaved.count() / float(repeats));
+
+    test.check(layout.data_size() > 0, "non-empty");
+}
+//------------------------------------------------------------------------------
+void shapes_draw_indirect_batch(auto& s) {
+    eagitest::case_ test{s, 4, "draw indirect batch"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    const gl_api glapi{s.context()};
+    const shape_generator shape{
+      glapi,
+      shapes::unit_twisted_torus(
+        shapes::vertex_attrib_kind::position, 6, 48, 4, 0.5F)};
+
+    std::vector<shape_draw_operation> ops(
+      std_size(shape.operation_count(shape.draw_variant(0))));
+    shape.instructions(glapi, cover(ops));
+
+    const span_size_t geometry_count{100};
+    shape_draw_indirect_batch batch;
+    for(const auto g : integer_range(geometry_count)) {
+        batch.add(
+          glapi,
+          view(ops),
+          limit_cast<gl_types::int_type>(g * shape.vertex_count()));
+    }
+
+    s.context()
+      .log()
+      .info("draw indirect batch")
+      .arg("operations", span_size(ops.size()) * geometry_count)
+      .arg("groups", batch.group_count());
+
+    test.check_equal(
+      batch.command_count(),
+      span_size(ops.size()) * geometry_count,
+      "command count");
+    test.check(batch.group_count() <= span_size(ops.size()), "group count");
+
+    batch.clear();
+    test.check_equal(batch.command_count(), 0, "cleared");
+}
+//------------------------------------------------------------------------------
+void shapes_draw_state_skipping(auto& s) {
+    eagitest::case_ test{s, 5, "draw state skipping"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+
+    std::vector<shape_draw_operation> ops;
+    for(const auto i : integer_range(64)) {
+        shapes::draw_operation draw_op{};
+        draw_op.mode = shapes::primitive_type::triangle_strip;
+        draw_op.idx_type = shapes::index_data_type::unsigned_16;
+        draw_op.first = span_size(i) * 32;
+        draw_op.count = 32;
+        draw_op.primitive_restart = true;
+        draw_op.primitive_restart_index = 0xFFFFU;
+        draw_op.cw_face_winding = (i >= 32);
+        ops.emplace_back(glapi, draw_op);
+    }
+
+    recorder.clear();
+    for(const auto& op : ops) {
+        op.draw(glapi);
+    }
+    const auto stateless{recorder.call_count("FrontFace")};
+
+    recorder.clear();
+    shape_draw_state state;
+    draw_using_instructions(glapi, view(ops), state);
+    const auto cached{recorder.call_count("FrontFace")};
+
+    s.context()
+      .log()
+      .info("draw state skipping")
+      .arg("operations", ops.size())
+      .arg("stateless", stateless)
+      .arg("cached", cached)
+      .arg("issued", state.issued_calls())
+      .arg("skipped", state.skipped_calls());
+
+    test.check_equal(stateless, span_size(ops.size()), "stateless front face");
+    test.check_equal(cached, 2, "cached front face");
+    test.check(state.skipped_calls() > 0, "skipped some");
+    if(glapi.constants().primitive_restart) {
+        // front face twice, enable and restart index once each
+        test.check_equal(state.issued_calls(), 4, "issued");
+    }
+
+    state.invalidate();
+    recorder.clear();
+    draw_using_instructions(glapi, view(ops), state);
+    test.check_equal(recorder.call_count("FrontFace"), 2, "after invalidate");
+}
+//------------------------------------------------------------------------------
+void shapes_draw_indirect_commands(auto& s) {
+    eagitest::case_ test{s, 6, "draw indirect commands"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+
+    const auto make_op{[&](
+                         shapes::primitive_type mode,
+                         shapes::index_data_type idx_type,
+                         span_size_t first,
+                         std::uint32_t phase) {
+        shapes::draw_operation draw_op{};
+        draw_op.mode = mode;
+        draw_op.idx_type = idx_type;
+        draw_op.first = first;
+        draw_op.count = 3;
+        draw_op.phase = phase;
+        return shape_draw_operation{glapi, draw_op};
+    }};
+    const auto indexed{shapes::index_data_type::unsigned_16};
+    const auto triangles{shapes::primitive_type::triangles};
+    const auto strip{shapes::primitive_type::triangle_strip};
+    // the second operation is drawn in a later phase than the others
+    const std::array<shape_draw_operation, 4> ops{
+      make_op(triangles, indexed, 0, 0U),
+      make_op(triangles, indexed, 3, 1U),
+      make_op(triangles, indexed, 6, 0U),
+      make_op(strip, shapes::index_data_type::none, 9, 0U)};
+
+    shape_draw_indirect_batch batch;
+    batch.add(glapi, view(ops), 0, 2, 5U);
+    batch.add(glapi, view(ops), 100, 2, 5U);
+    test.check_equal(batch.group_count(), 3, "group count");
+    test.check_equal(batch.command_count(), 8, "command count");
+
+    batch.upload(glapi, buffer_name{1U});
+    batch.submit(glapi, buffer_name{1U});
+
+    // the groups are submitted in the order of the phases
+    std::vector<std::tuple<bool, std::uintptr_t, gl_types::sizei_type>> draws;
+    memory::const_block uploaded;
+    recorder.for_each_command([&](gl_command_id id, memory::const_block args) {
+        const auto indirect{[&](std::size_t offs, bool elements) {
+            draws.emplace_back(
+              elements,
+              reinterpret_cast<std::uintptr_t>(
+                recorded_arg<const void*>(args, offs)),
+              recorded_arg<gl_types::sizei_type>(args, offs + sizeof(void*)));
+        }};
+        const auto name{gl_command_recorder::command_name(id)};
+        if(name == string_view{"MultiDrawElementsIndirect"}) {
+            indirect(2U * sizeof(gl_types::enum_type), true);
+        } else if(name == string_view{"MultiDrawArraysIndirect"}) {
+            indirect(sizeof(gl_types::enum_type), false);
+        } else if(name == string_view{"BufferData"}) {
+            const auto offs{sizeof(gl_types::enum_type)};
+            uploaded = {
+              recorded_arg<const byte*>(
+                args, offs + sizeof(gl_types::sizeiptr_type)),
+              span_size(recorded_arg<gl_types::sizeiptr_type>(args, offs))};
+        }
+    });
+
+    const auto elements_size{sizeof(draw_elements_indirect_command)};
+    const auto arrays_size{sizeof(draw_arrays_indirect_command)};
+    const auto phase1_offs{4U * elements_size + 2U * arrays_size};
+    test.check_equal(draws.size(), 3U, "multi-draw calls");
+    if(draws.size() != 3U) {
+        return;
+    }
+    test.check(std::get<0>(draws[0]), "phase 0 indexed");
+    test.check_equal(std::get<1>(draws[0]), 0U, "phase 0 indexed offset");
+    test.check_equal(std::get<2>(draws[0]), 4, "phase 0 indexed count");
+    test.check(not std::get<0>(draws[1]), "phase 0 arrays");
+    test.check_equal(
+      std::get<1>(draws[1]), 4U * elements_size, "phase 0 arrays offset");
+    test.check_equal(std::get<2>(draws[1]), 2, "phase 0 arrays count");
+    test.check(std::get<0>(draws[2]), "phase 1 indexed");
+    test.check_equal(std::get<1>(draws[2]), phase1_offs, "phase 1 offset");
+    test.check_equal(std::get<2>(draws[2]), 2, "phase 1 indexed count");
+
+    test.check_equal(
+      uploaded.size(),
+      span_size(phase1_offs + 2U * elements_size),
+      "uploaded size");
+    if(uploaded.size() != span_size(phase1_offs + 2U * elements_size)) {
+        return;
+    }
+
+    const auto check_elements{[&](
+                                std::size_t offs,
+                                gl_types::uint_type first_index,
+                                gl_types::int_type base_vertex) {
+        draw_elements_indirect_command cmd{};
+        std::memcpy(&cmd, uploaded.data() + offs, sizeof(cmd));
+        test.check_equal(cmd.count, 3U, "elements count");
+        test.check_equal(cmd.instance_count, 2U, "elements instances");
+        test.check_equal(cmd.first_index, first_index, "first index");
+        test.check_equal(cmd.base_vertex, base_vertex, "base vertex");
+        test.check_equal(cmd.base_instance, 5U, "elements base instance");
+    }};
+    const auto check_arrays{[&](std::size_t offs, gl_types::uint_type first) {
+        draw_arrays_indirect_command cmd{};
+        std::memcpy(&cmd, uploaded.data() + offs, sizeof(cmd));
+        test.check_equal(cmd.count, 3U, "arrays count");
+        test.check_equal(cmd.instance_count, 2U, "arrays instances");
+        test.check_equal(cmd.first, first, "arrays first");
+        test.check_equal(cmd.base_instance, 5U, "arrays base instance");
+    }};
+
+    check_elements(0U * elements_size, 0U, 0);
+    check_elements(1U * elements_size, 6U, 0);
+    check_elements(2U * elements_size, 0U, 100);
+    check_elements(3U * elements_size, 6U, 100);
+    check_arrays(4U * elements_size, 9U);
+    check_arrays(4U * elements_size + arrays_size, 109U);
+    check_elements(phase1_offs, 3U, 0);
+    check_elements(phase1_offs + elements_size, 3U, 100);
+}
+//------------------------------------------------------------------------------
+auto test_main(eagine::test_ctx& ctx) -> int {
+    eagitest::ctx_suite test{ctx, "shapes", 6};
+    test.once(shapes_interleaved_layout);
+    test.once(shapes_interleaved_packing);
+    test.once(shapes_interleaved_packing_time);
+    test.once(shapes_draw_indirect_batch);
+    test.once(shapes_draw_state_skipping);
+    test.once(shapes_draw_indirect_commands);
+    return test.exit_code();
+}
+//------------------------------------------------------------------------------
+#include <eagine/testing/unit_end_ctx.hpp>
@@ -0,0 +1,289 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.oglplus:state_tracker;
+import std;
+import eagine.core.types;
+import :config;
+import :enum_types;
+import :objects;
+import :api_traits;
+import :api;
+
+namespace eagine::oglplus {
+//------------------------------------------------------------------------------
+/// @brief Counters of GL state calls issued and elided by the state tracker.
+/// @ingroup gl_api_wrap
+/// @see basic_gl_state_tracker
+export struct gl_state_tracker_stats {
+    /// @brief The number of state calls forwarded to GL.
+    span_size_t issued{0};
+    /// @brief The number of state calls dropped as no-ops.
+    span_size_t elided{0};
+};
+//------------------------------------------------------------------------------
+/// @brief Decorator over GL operations, dropping redundant state changes.
+/// @ingroup gl_api_wrap
+/// @see gl_state_tracker
+/// @see gl_state_tracker_stats
+///
+/// Keeps a shadow copy of the buffer, texture, program, vertex array and
+/// framebuffer bindings, of the enabled capabilities and of the blend and
+/// depth functions set through it, and forwards calls only if they change
+/// the shadowed value. Shadowing a binding of a new target or capability
+/// allocates, so the functions updating these are not noexcept. One tracker
+/// should be used per GL context and all state changes covered by the
+/// tracker should go through it. After foreign code touches the GL state
+/// (or after deleting a bound object), call invalidate.
+export template <typename ApiTraits>
+class basic_gl_state_tracker {
+public:
+    /// @brief Construction referencing the GL API wrapper of a context.
+    basic_gl_state_tracker(const basic_gl_api<ApiTraits>& api) noexcept
+      : _api{api} {}
+
+    basic_gl_state_tracker(basic_gl_state_tracker&&) = delete;
+    basic_gl_state_tracker(const basic_gl_state_tracker&) = delete;
+    auto operator=(basic_gl_state_tracker&&) = delete;
+    auto operator=(const basic_gl_state_tracker&) = delete;
+    ~basic_gl_state_tracker() noexcept = default;
+
+    /// @brief Returns a reference to the wrapped GL API.
+    auto api() const noexcept -> const basic_gl_api<ApiTraits>& {
+        return _api;
+    }
+
+    /// @brief Binds the specified buffer to the specified target if needed.
+    auto bind_buffer(
+      const buffer_target target,
+      const buffer_name buf) -> bool {
+        if(_update_binding(_buffers, target, buf)) {
+            _api.operations().bind_buffer(target, buf);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Makes the specified texture unit active if needed.
+    auto active_texture(const texture_unit unit) noexcept -> bool {
+        if(_has_active_unit and (_active_unit == unit)) {
+            ++_frame.elided;
+            return false;
+        }
+        _active_unit = unit;
+        _has_active_unit = true;
+        ++_frame.issued;
+        _api.operations().active_texture(unit);
+        return true;
+    }
+
+    /// @brief Binds the specified texture to the target of the active unit.
+    /// @see active_texture
+    auto bind_texture(
+      const texture_target target,
+      const texture_name tex) -> bool {
+        if(not _has_active_unit) {
+            // the active unit is unknown so the binding cannot be shadowed
+            ++_frame.issued;
+            _api.operations().bind_texture(target, tex);
+            return true;
+        }
+        if(_update_binding(
+             _textures, texture_binding{_active_unit, target}, tex)) {
+            _api.operations().bind_texture(target, tex);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Makes the specified program current if needed.
+    auto use_program(const program_name prog) noexcept -> bool {
+        if(_update(_program, prog)) {
+            _api.operations().use_program(prog);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Binds the specified vertex array if needed.
+    ///
+    /// The element array buffer binding is part of the vertex array state,
+    /// so its shadow is dropped when a different vertex array gets bound.
+    auto bind_vertex_array(const vertex_array_name vao) noexcept -> bool {
+        if(_update(_vertex_array, vao)) {
+            std::erase_if(_buffers, [this](const auto& entry) {
+                return entry.first == _api.constants().element_array_buffer;
+            });
+            _api.operations().bind_vertex_array(vao);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Binds the specified framebuffer to a target if needed.
+    ///
+    /// Binding to the combined framebuffer target replaces the shadow of
+    /// the draw and read bindings, binding to either of these drops the
+    /// shadow of the combined one.
+    auto bind_framebuffer(
+      const framebuffer_target target,
+      const framebuffer_name fbo) -> bool {
+        const auto& GL{_api.constants()};
+        if(target == GL.framebuffer) {
+            std::erase_if(_framebuffers, [&](const auto& entry) {
+                return entry.first != target;
+            });
+        } else {
+            std::erase_if(_framebuffers, [&](const auto& entry) {
+                return entry.first == GL.framebuffer;
+            });
+        }
+        if(_update_binding(_framebuffers, target, fbo)) {
+            _api.operations().bind_framebuffer(target, fbo);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Enables the specified capability if needed.
+    auto enable(const capability cap) -> bool {
+        if(_update_binding(_capabilities, cap, true)) {
+            _api.operations().enable(cap);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Disables the specified capability if needed.
+    auto disable(const capability cap) -> bool {
+        if(_update_binding(_capabilities, cap, false)) {
+            _api.operations().disable(cap);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Sets the source and destination blend functions if needed.
+    auto blend_func(
+      const blend_function sfactor,
+      const blend_function dfactor) noexcept -> bool {
+        if(_update(_blend_func, std::make_pair(sfactor, dfactor))) {
+            _api.operations().blend_func(sfactor, dfactor);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Sets the depth comparison function if needed.
+    auto depth_func(const compare_function func) noexcept -> bool {
+        if(_update(_depth_func, func)) {
+            _api.operations().depth_func(func);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Forgets all shadowed state.
+    ///
+    /// Should be called after GL code not going through this tracker
+    /// changed the bindings, capabilities or the tracked functions.
+    void invalidate() noexcept {
+        _buffers.clear();
+        _textures.clear();
+        _framebuffers.clear();
+        _capabilities.clear();
+        _program.reset();
+        _vertex_array.reset();
+        _blend_func.reset();
+        _depth_func.reset();
+        _has_active_unit = false;
+    }
+
+    /// @brief Returns the call counters of the current frame.
+    auto frame_stats() const noexcept -> const gl_state_tracker_stats& {
+        return _frame;
+    }
+
+    /// @brief Returns the call counters accumulated over all finished frames.
+    auto total_stats() const noexcept -> const gl_state_tracker_stats& {
+        return _total;
+    }
+
+    /// @brief Finishes the current frame, returns its call counters.
+    ///
+    /// The shadowed state is kept, only the per-frame counters are reset.
+    auto end_frame() noexcept -> gl_state_tracker_stats {
+        const auto result{_frame};
+        _total.issued += _frame.issued;
+        _total.elided += _frame.elided;
+        _frame = {};
+        return result;
+    }
+
+private:
+    struct texture_binding {
+        texture_unit unit;
+        texture_target target;
+
+        friend auto operator==(const texture_binding&, const texture_binding&)
+          -> bool = default;
+    };
+
+    template <typename T>
+    auto _update(std::optional<T>& cached, const T& value) noexcept -> bool {
+        if(cached and (*cached == value)) {
+            ++_frame.elided;
+            return false;
+        }
+        cached = value;
+        ++_frame.issued;
+        return true;
+    }
+
+    template <typename K, typename V>
+    auto _update_binding(
+      std::vector<std::pair<K, V>>& bindings,
+      const K& key,
+      const V& value) -> bool {
+        const auto pos{std::find_if(
+          bindings.begin(), bindings.end(), [&](const auto& entry) {
+              return entry.first == key;
+          })};
+        if(pos == bindings.end()) {
+            bindings.emplace_back(key, value);
+        } else if(pos->second == value) {
+            ++_frame.elided;
+            return false;
+        } else {
+            pos->second = value;
+        }
+        ++_frame.issued;
+        return true;
+    }
+
+    const basic_gl_api<ApiTraits>& _api;
+    // there are only a handful of targets and capabilities in use at a time
+    // so a linear search in a small vector beats a map here
+    std::vector<std::pair<buffer_target, buffer_name>> _buffers;
+    std::vector<std::pair<texture_binding, texture_name>> _textures;
+    std::vector<std::pair<framebuffer_target, framebuffer_name>> _framebuffers;
+    std::vector<std::pair<capability, bool>> _capabilities;
+    std::optional<program_name> _program;
+    std::optional<vertex_array_name> _vertex_array;
+    std::optional<std::pair<blend_function, blend_function>> _blend_func;
+    std::optional<compare_function> _depth_func;
+    texture_unit _active_unit{0};
+    bool _has_active_unit{false};
+    gl_state_tracker_stats _frame{};
+    gl_state_tracker_stats _total{};
+};
+//------------------------------------------------------------------------------
+/// @brief Alias for the state tracker over the default GL API wrapper.
+/// @ingroup gl_api_wrap
+export using gl_state_tracker = basic_gl_state_tracker<gl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::oglplus
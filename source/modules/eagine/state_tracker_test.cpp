@@ -0,0 +1,156 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+
+#include <eagine/testing/unit_begin_ctx.hpp>
+import std;
+import eagine.core;
+import eagine.oglplus;
+//------------------------------------------------------------------------------
+void state_tracker_bindings(auto& s) {
+    eagitest::case_ test{s, 1, "bindings"};
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+    gl_state_tracker gls{glapi};
+
+    test.check(gls.bind_buffer(GL.array_buffer, buffer_name{1U}), "buffer 1");
+    test.check(
+      not gls.bind_buffer(GL.array_buffer, buffer_name{1U}), "buffer 2");
+    test.check(gls.bind_buffer(GL.array_buffer, buffer_name{2U}), "buffer 3");
+    test.check(gls.bind_buffer(GL.uniform_buffer, buffer_name{2U}), "buffer 4");
+
+    test.check(gls.use_program(program_name{3U}), "program 1");
+    test.check(not gls.use_program(program_name{3U}), "program 2");
+
+    test.check(gls.active_texture(GL.texture0), "unit 1");
+    test.check(gls.bind_texture(GL.texture_2d, texture_name{4U}), "texture 1");
+    test.check(
+      not gls.bind_texture(GL.texture_2d, texture_name{4U}), "texture 2");
+    test.check(gls.active_texture(GL.texture0 + 1), "unit 2");
+    test.check(gls.bind_texture(GL.texture_2d, texture_name{4U}), "texture 3");
+    test.check(not gls.active_texture(GL.texture0 + 1), "unit 3");
+
+    test.check(
+      gls.bind_buffer(GL.element_array_buffer, buffer_name{5U}), "ebo 1");
+    test.check(
+      not gls.bind_buffer(GL.element_array_buffer, buffer_name{5U}), "ebo 2");
+    test.check(gls.bind_vertex_array(vertex_array_name{6U}), "vao 1");
+    test.check(not gls.bind_vertex_array(vertex_array_name{6U}), "vao 2");
+    test.check(
+      gls.bind_buffer(GL.element_array_buffer, buffer_name{5U}), "ebo 3");
+
+    const auto& stats{gls.frame_stats()};
+    test.check_equal(stats.issued, 11, "issued");
+    test.check_equal(stats.elided, 6, "elided");
+
+    // only the issued calls reach GL
+    test.check_equal(recorder.call_count("BindBuffer"), 5, "bind buffer");
+    test.check_equal(recorder.call_count("UseProgram"), 1, "use program");
+    test.check_equal(recorder.call_count("ActiveTexture"), 2, "active unit");
+    test.check_equal(recorder.call_count("BindTexture"), 2, "bind texture");
+    test.check_equal(
+      recorder.call_count("BindVertexArray"), 1, "bind vertex array");
+}
+//------------------------------------------------------------------------------
+void state_tracker_capabilities(auto& s) {
+    eagitest::case_ test{s, 2, "capabilities"};
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+    gl_state_tracker gls{glapi};
+
+    test.check(gls.enable(GL.depth_test), "enable 1");
+    test.check(not gls.enable(GL.depth_test), "enable 2");
+    test.check(gls.disable(GL.depth_test), "disable 1");
+    test.check(not gls.disable(GL.depth_test), "disable 2");
+    test.check(gls.disable(GL.blend), "disable 3");
+
+    test.check(
+      gls.blend_func(GL.src_alpha, GL.one_minus_src_alpha), "blend 1");
+    test.check(
+      not gls.blend_func(GL.src_alpha, GL.one_minus_src_alpha), "blend 2");
+    test.check(gls.blend_func(GL.one, GL.one_minus_src_alpha), "blend 3");
+
+    test.check(gls.depth_func(GL.less), "depth 1");
+    test.check(not gls.depth_func(GL.less), "depth 2");
+    test.check(gls.depth_func(GL.lequal), "depth 3");
+
+    test.check_equal(recorder.call_count("Enable"), 1, "enable calls");
+    test.check_equal(recorder.call_count("Disable"), 2, "disable calls");
+    test.check_equal(recorder.call_count("BlendFunc"), 2, "blend calls");
+    test.check_equal(recorder.call_count("DepthFunc"), 2, "depth calls");
+
+    gls.invalidate();
+    test.check(gls.enable(GL.depth_test), "invalidated enable");
+    test.check(gls.depth_func(GL.lequal), "invalidated depth");
+    test.check_equal(recorder.call_count("Enable"), 2, "enable after");
+    test.check_equal(recorder.call_count("DepthFunc"), 3, "depth after");
+}
+//------------------------------------------------------------------------------
+void state_tracker_frames(auto& s) {
+    eagitest::case_ test{s, 3, "per-frame counters"};
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+    const auto& GL{glapi.constants()};
+    gl_state_tracker gls{glapi};
+
+    const int frames{16};
+    const int modules{8};
+    for(int f = 0; f < frames; ++f) {
+        for(int m = 0; m < modules; ++m) {
+            gls.enable(GL.depth_test);
+            gls.depth_func(GL.less);
+            gls.use_program(program_name{1U});
+            gls.bind_vertex_array(vertex_array_name{2U});
+        }
+        const auto stats{gls.end_frame()};
+        if(f == 0) {
+            test.check_equal(stats.issued, 4, "first frame issued");
+            test.check_equal(stats.elided, 4 * (modules - 1), "first elided");
+        } else {
+            test.check_equal(stats.issued, 0, "next frame issued");
+            test.check_equal(stats.elided, 4 * modules, "next elided");
+        }
+    }
+
+    s.context()
+      .log()
+      .info("state tracker counters")
+      .arg("frames", frames)
+      .arg("issued", gls.total_stats().issued)
+      .arg("elided", gls.total_stats().elided);
+
+    test.check_equal(gls.frame_stats().issued, 0, "reset issued");
+    test.check_equal(gls.frame_stats().elided, 0, "reset elided");
+    test.check_equal(
+      gls.total_stats().issued + gls.total_stats().elided,
+      4 * modules * frames,
+      "total");
+    test.check_equal(
+      recorder.call_count("Enable") + recorder.call_count("DepthFunc") +
+        recorder.call_count("UseProgram") +
+        recorder.call_count("BindVertexArray"),
+      gls.total_stats().issued,
+      "forwarded calls");
+}
+//------------------------------------------------------------------------------
+auto test_main(eagine::test_ctx& ctx) -> int {
+    eagitest::ctx_suite test{ctx, "state_tracker", 3};
+    test.once(state_tracker_bindings);
+    test.once(state_tracker_capabilities);
+    test.once(state_tracker_frames);
+    return test.exit_code();
+}
+//------------------------------------------------------------------------------
+#include <eagine/testing/unit_end_ctx.hpp>
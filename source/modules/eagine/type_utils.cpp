@@ -540,5 +540,499 @@ constexpr auto internal_format_of() noexcept -> pixel_internal_format {
     return pixel_internal_format{internal_format_of(std::type_identity<T>{})};
 }
 //------------------------------------------------------------------------------
+// uniform_type_of
+//------------------------------------------------------------------------------
+// the scalar uniform types are the same as the data types, other types
+// (for example texture units set to sampler uniforms) have no single type
+export template <typename T>
+constexpr auto uniform_type_of(const std::type_identity<T>) noexcept
+  -> gl_types::enum_type {
+    if constexpr(
+      std::is_same_v<T, gl_types::int_type> or
+      std::is_same_v<T, gl_types::uint_type> or
+      std::is_same_v<T, gl_types::float_type> or
+      std::is_same_v<T, gl_types::double_type>) {
+        return data_type_of(std::type_identity<T>{});
+    } else {
+        return 0;
+    }
+}
+//------------------------------------------------------------------------------
+export template <bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<vector<gl_types::int_type, 2, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_INT_VEC2
+    return GL_INT_VEC2;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<vector<gl_types::int_type, 3, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_INT_VEC3
+    return GL_INT_VEC3;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<vector<gl_types::int_type, 4, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_INT_VEC4
+    return GL_INT_VEC4;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<vector<gl_types::uint_type, 2, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_UNSIGNED_INT_VEC2
+    return GL_UNSIGNED_INT_VEC2;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<vector<gl_types::uint_type, 3, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_UNSIGNED_INT_VEC3
+    return GL_UNSIGNED_INT_VEC3;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<vector<gl_types::uint_type, 4, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_UNSIGNED_INT_VEC4
+    return GL_UNSIGNED_INT_VEC4;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<vector<gl_types::float_type, 2, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_FLOAT_VEC2
+    return GL_FLOAT_VEC2;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<vector<gl_types::float_type, 3, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_FLOAT_VEC3
+    return GL_FLOAT_VEC3;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<vector<gl_types::float_type, 4, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_FLOAT_VEC4
+    return GL_FLOAT_VEC4;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<vector<gl_types::double_type, 2, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_DOUBLE_VEC2
+    return GL_DOUBLE_VEC2;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<vector<gl_types::double_type, 3, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_DOUBLE_VEC3
+    return GL_DOUBLE_VEC3;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<vector<gl_types::double_type, 4, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_DOUBLE_VEC4
+    return GL_DOUBLE_VEC4;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool RM, bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<matrix<gl_types::float_type, 2, 2, RM, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_FLOAT_MAT2
+    return GL_FLOAT_MAT2;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool RM, bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<matrix<gl_types::float_type, 2, 3, RM, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_FLOAT_MAT2x3
+    return GL_FLOAT_MAT2x3;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool RM, bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<matrix<gl_types::float_type, 2, 4, RM, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_FLOAT_MAT2x4
+    return GL_FLOAT_MAT2x4;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool RM, bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<matrix<gl_types::float_type, 3, 2, RM, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_FLOAT_MAT3x2
+    return GL_FLOAT_MAT3x2;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool RM, bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<matrix<gl_types::float_type, 3, 3, RM, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_FLOAT_MAT3
+    return GL_FLOAT_MAT3;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool RM, bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<matrix<gl_types::float_type, 3, 4, RM, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_FLOAT_MAT3x4
+    return GL_FLOAT_MAT3x4;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool RM, bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<matrix<gl_types::float_type, 4, 2, RM, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_FLOAT_MAT4x2
+    return GL_FLOAT_MAT4x2;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool RM, bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<matrix<gl_types::float_type, 4, 3, RM, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_FLOAT_MAT4x3
+    return GL_FLOAT_MAT4x3;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+export template <bool RM, bool V>
+constexpr auto uniform_type_of(
+  const std::type_identity<matrix<gl_types::float_type, 4, 4, RM, V>>) noexcept
+  -> gl_types::enum_type {
+#ifdef GL_FLOAT_MAT4
+    return GL_FLOAT_MAT4;
+#else
+    return 0;
+#endif
+}
+//------------------------------------------------------------------------------
+/// @brief Returns the GL type of uniforms set from values of C++ type T.
+/// @ingroup gl_api_wrap
+/// @see data_type_of
+/// @see sl_data_type_of
+///
+/// Returns zero if there is no single such GL type for T.
+export template <typename T>
+constexpr auto uniform_type_of() noexcept -> gl_types::enum_type {
+    return uniform_type_of(std::type_identity<T>{});
+}
+//------------------------------------------------------------------------------
+/// @brief Indicates if the GL uniform type is a sampler or an image type.
+/// @ingroup gl_api_wrap
+/// @see uniform_type_of
+///
+/// Uniforms of these types are set to the index of a texture or image unit.
+export constexpr auto is_sampler_or_image_type(
+  const gl_types::enum_type type) noexcept -> bool {
+    switch(type) {
+#ifdef GL_SAMPLER_1D
+        case GL_SAMPLER_1D:
+#endif
+#ifdef GL_SAMPLER_2D
+        case GL_SAMPLER_2D:
+#endif
+#ifdef GL_SAMPLER_3D
+        case GL_SAMPLER_3D:
+#endif
+#ifdef GL_SAMPLER_CUBE
+        case GL_SAMPLER_CUBE:
+#endif
+#ifdef GL_SAMPLER_1D_ARRAY
+        case GL_SAMPLER_1D_ARRAY:
+#endif
+#ifdef GL_SAMPLER_2D_ARRAY
+        case GL_SAMPLER_2D_ARRAY:
+#endif
+#ifdef GL_SAMPLER_2D_MULTISAMPLE
+        case GL_SAMPLER_2D_MULTISAMPLE:
+#endif
+#ifdef GL_SAMPLER_2D_MULTISAMPLE_ARRAY
+        case GL_SAMPLER_2D_MULTISAMPLE_ARRAY:
+#endif
+#ifdef GL_SAMPLER_BUFFER
+        case GL_SAMPLER_BUFFER:
+#endif
+#ifdef GL_SAMPLER_2D_RECT
+        case GL_SAMPLER_2D_RECT:
+#endif
+#ifdef GL_SAMPLER_CUBE_MAP_ARRAY
+        case GL_SAMPLER_CUBE_MAP_ARRAY:
+#endif
+#ifdef GL_SAMPLER_1D_SHADOW
+        case GL_SAMPLER_1D_SHADOW:
+#endif
+#ifdef GL_SAMPLER_2D_SHADOW
+        case GL_SAMPLER_2D_SHADOW:
+#endif
+#ifdef GL_SAMPLER_1D_ARRAY_SHADOW
+        case GL_SAMPLER_1D_ARRAY_SHADOW:
+#endif
+#ifdef GL_SAMPLER_2D_ARRAY_SHADOW
+        case GL_SAMPLER_2D_ARRAY_SHADOW:
+#endif
+#ifdef GL_SAMPLER_CUBE_SHADOW
+        case GL_SAMPLER_CUBE_SHADOW:
+#endif
+#ifdef GL_SAMPLER_2D_RECT_SHADOW
+        case GL_SAMPLER_2D_RECT_SHADOW:
+#endif
+#ifdef GL_SAMPLER_CUBE_MAP_ARRAY_SHADOW
+        case GL_SAMPLER_CUBE_MAP_ARRAY_SHADOW:
+#endif
+#ifdef GL_INT_SAMPLER_1D
+        case GL_INT_SAMPLER_1D:
+#endif
+#ifdef GL_INT_SAMPLER_2D
+        case GL_INT_SAMPLER_2D:
+#endif
+#ifdef GL_INT_SAMPLER_3D
+        case GL_INT_SAMPLER_3D:
+#endif
+#ifdef GL_INT_SAMPLER_CUBE
+        case GL_INT_SAMPLER_CUBE:
+#endif
+#ifdef GL_INT_SAMPLER_1D_ARRAY
+        case GL_INT_SAMPLER_1D_ARRAY:
+#endif
+#ifdef GL_INT_SAMPLER_2D_ARRAY
+        case GL_INT_SAMPLER_2D_ARRAY:
+#endif
+#ifdef GL_INT_SAMPLER_2D_MULTISAMPLE
+        case GL_INT_SAMPLER_2D_MULTISAMPLE:
+#endif
+#ifdef GL_INT_SAMPLER_2D_MULTISAMPLE_ARRAY
+        case GL_INT_SAMPLER_2D_MULTISAMPLE_ARRAY:
+#endif
+#ifdef GL_INT_SAMPLER_BUFFER
+        case GL_INT_SAMPLER_BUFFER:
+#endif
+#ifdef GL_INT_SAMPLER_2D_RECT
+        case GL_INT_SAMPLER_2D_RECT:
+#endif
+#ifdef GL_INT_SAMPLER_CUBE_MAP_ARRAY
+        case GL_INT_SAMPLER_CUBE_MAP_ARRAY:
+#endif
+#ifdef GL_UNSIGNED_INT_SAMPLER_1D
+        case GL_UNSIGNED_INT_SAMPLER_1D:
+#endif
+#ifdef GL_UNSIGNED_INT_SAMPLER_2D
+        case GL_UNSIGNED_INT_SAMPLER_2D:
+#endif
+#ifdef GL_UNSIGNED_INT_SAMPLER_3D
+        case GL_UNSIGNED_INT_SAMPLER_3D:
+#endif
+#ifdef GL_UNSIGNED_INT_SAMPLER_CUBE
+        case GL_UNSIGNED_INT_SAMPLER_CUBE:
+#endif
+#ifdef GL_UNSIGNED_INT_SAMPLER_1D_ARRAY
+        case GL_UNSIGNED_INT_SAMPLER_1D_ARRAY:
+#endif
+#ifdef GL_UNSIGNED_INT_SAMPLER_2D_ARRAY
+        case GL_UNSIGNED_INT_SAMPLER_2D_ARRAY:
+#endif
+#ifdef GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE
+        case GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE:
+#endif
+#ifdef GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY
+        case GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY:
+#endif
+#ifdef GL_UNSIGNED_INT_SAMPLER_BUFFER
+        case GL_UNSIGNED_INT_SAMPLER_BUFFER:
+#endif
+#ifdef GL_UNSIGNED_INT_SAMPLER_2D_RECT
+        case GL_UNSIGNED_INT_SAMPLER_2D_RECT:
+#endif
+#ifdef GL_UNSIGNED_INT_SAMPLER_CUBE_MAP_ARRAY
+        case GL_UNSIGNED_INT_SAMPLER_CUBE_MAP_ARRAY:
+#endif
+#ifdef GL_IMAGE_1D
+        case GL_IMAGE_1D:
+#endif
+#ifdef GL_IMAGE_2D
+        case GL_IMAGE_2D:
+#endif
+#ifdef GL_IMAGE_3D
+        case GL_IMAGE_3D:
+#endif
+#ifdef GL_IMAGE_CUBE
+        case GL_IMAGE_CUBE:
+#endif
+#ifdef GL_IMAGE_1D_ARRAY
+        case GL_IMAGE_1D_ARRAY:
+#endif
+#ifdef GL_IMAGE_2D_ARRAY
+        case GL_IMAGE_2D_ARRAY:
+#endif
+#ifdef GL_IMAGE_2D_MULTISAMPLE
+        case GL_IMAGE_2D_MULTISAMPLE:
+#endif
+#ifdef GL_IMAGE_2D_MULTISAMPLE_ARRAY
+        case GL_IMAGE_2D_MULTISAMPLE_ARRAY:
+#endif
+#ifdef GL_IMAGE_BUFFER
+        case GL_IMAGE_BUFFER:
+#endif
+#ifdef GL_IMAGE_2D_RECT
+        case GL_IMAGE_2D_RECT:
+#endif
+#ifdef GL_IMAGE_CUBE_MAP_ARRAY
+        case GL_IMAGE_CUBE_MAP_ARRAY:
+#endif
+#ifdef GL_INT_IMAGE_1D
+        case GL_INT_IMAGE_1D:
+#endif
+#ifdef GL_INT_IMAGE_2D
+        case GL_INT_IMAGE_2D:
+#endif
+#ifdef GL_INT_IMAGE_3D
+        case GL_INT_IMAGE_3D:
+#endif
+#ifdef GL_INT_IMAGE_CUBE
+        case GL_INT_IMAGE_CUBE:
+#endif
+#ifdef GL_INT_IMAGE_1D_ARRAY
+        case GL_INT_IMAGE_1D_ARRAY:
+#endif
+#ifdef GL_INT_IMAGE_2D_ARRAY
+        case GL_INT_IMAGE_2D_ARRAY:
+#endif
+#ifdef GL_INT_IMAGE_2D_MULTISAMPLE
+        case GL_INT_IMAGE_2D_MULTISAMPLE:
+#endif
+#ifdef GL_INT_IMAGE_2D_MULTISAMPLE_ARRAY
+        case GL_INT_IMAGE_2D_MULTISAMPLE_ARRAY:
+#endif
+#ifdef GL_INT_IMAGE_BUFFER
+        case GL_INT_IMAGE_BUFFER:
+#endif
+#ifdef GL_INT_IMAGE_2D_RECT
+        case GL_INT_IMAGE_2D_RECT:
+#endif
+#ifdef GL_INT_IMAGE_CUBE_MAP_ARRAY
+        case GL_INT_IMAGE_CUBE_MAP_ARRAY:
+#endif
+#ifdef GL_UNSIGNED_INT_IMAGE_1D
+        case GL_UNSIGNED_INT_IMAGE_1D:
+#endif
+#ifdef GL_UNSIGNED_INT_IMAGE_2D
+        case GL_UNSIGNED_INT_IMAGE_2D:
+#endif
+#ifdef GL_UNSIGNED_INT_IMAGE_3D
+        case GL_UNSIGNED_INT_IMAGE_3D:
+#endif
+#ifdef GL_UNSIGNED_INT_IMAGE_CUBE
+        case GL_UNSIGNED_INT_IMAGE_CUBE:
+#endif
+#ifdef GL_UNSIGNED_INT_IMAGE_1D_ARRAY
+        case GL_UNSIGNED_INT_IMAGE_1D_ARRAY:
+#endif
+#ifdef GL_UNSIGNED_INT_IMAGE_2D_ARRAY
+        case GL_UNSIGNED_INT_IMAGE_2D_ARRAY:
+#endif
+#ifdef GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE
+        case GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE:
+#endif
+#ifdef GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE_ARRAY
+        case GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE_ARRAY:
+#endif
+#ifdef GL_UNSIGNED_INT_IMAGE_BUFFER
+        case GL_UNSIGNED_INT_IMAGE_BUFFER:
+#endif
+#ifdef GL_UNSIGNED_INT_IMAGE_2D_RECT
+        case GL_UNSIGNED_INT_IMAGE_2D_RECT:
+#endif
+#ifdef GL_UNSIGNED_INT_IMAGE_CUBE_MAP_ARRAY
+        case GL_UNSIGNED_INT_IMAGE_CUBE_MAP_ARRAY:
+#endif
+            return true;
+        default:
+            break;
+    }
+    return false;
+}
+//------------------------------------------------------------------------------
 } // namespace eagine::oglplus
 
@@ -0,0 +1,347 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#include <cassert>
+
+export module eagine.oglplus:uniform_block;
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.math;
+import :config;
+import :enum_types;
+import :objects;
+import :math;
+import :api;
+import :buffer_ring;
+
+namespace eagine::oglplus {
+//------------------------------------------------------------------------------
+/// @brief Memory layouts of GLSL interface blocks.
+/// @ingroup gl_utils
+/// @see glsl_block
+export enum class glsl_block_layout : std::uint8_t {
+    /// @brief The std140 layout, usable with uniform and storage blocks.
+    std140,
+    /// @brief The std430 layout, usable with shader storage blocks.
+    std430
+};
+//------------------------------------------------------------------------------
+constexpr auto glsl_align_up(const span_size_t offs, const span_size_t align)
+  -> span_size_t {
+    return ((offs + align - 1) / align) * align;
+}
+//------------------------------------------------------------------------------
+/// @brief Alignment, size and store function of a GLSL block member type.
+/// @ingroup gl_utils
+/// @see glsl_block
+///
+/// Specialized for 32-bit scalars, bool, vectors and float matrices from
+/// the math module and for std::array of these.
+export template <typename T, glsl_block_layout L>
+struct glsl_block_member;
+
+export template <typename T, glsl_block_layout L>
+    requires(std::is_arithmetic_v<T> and (sizeof(T) == 4))
+struct glsl_block_member<T, L> {
+    static constexpr const span_size_t alignment{4};
+    static constexpr const span_size_t size{4};
+
+    static void store(byte* dest, const T value) noexcept {
+        std::memcpy(dest, &value, sizeof(T));
+    }
+};
+
+export template <glsl_block_layout L>
+struct glsl_block_member<bool, L> {
+    static constexpr const span_size_t alignment{4};
+    static constexpr const span_size_t size{4};
+
+    // GLSL booleans take four bytes
+    static void store(byte* dest, const bool value) noexcept {
+        const gl_types::uint_type uvalue{value ? 1U : 0U};
+        std::memcpy(dest, &uvalue, sizeof(uvalue));
+    }
+};
+
+export template <typename T, int N, bool V, glsl_block_layout L>
+    requires(sizeof(T) == 4)
+struct glsl_block_member<vector<T, N, V>, L> {
+    static constexpr const span_size_t alignment{N == 2 ? 8 : 16};
+    static constexpr const span_size_t size{N * 4};
+
+    static void store(byte* dest, const vector<T, N, V>& value) noexcept {
+        const auto elements{element_view(value)};
+        std::memcpy(dest, elements.data(), std_size(size));
+    }
+};
+
+// the columns (or the rows of row-major matrices, which must be declared
+// with layout(row_major) in the shader) are stored like an array of vectors
+export template <typename T, int C, int R, bool RM, bool V, glsl_block_layout L>
+    requires(sizeof(T) == 4)
+struct glsl_block_member<math::matrix<T, C, R, RM, V>, L> {
+    static constexpr const span_size_t major{RM ? R : C};
+    static constexpr const span_size_t minor{RM ? C : R};
+    static constexpr const span_size_t alignment{
+      (L == glsl_block_layout::std430 and minor == 2) ? 8 : 16};
+    static constexpr const span_size_t stride{alignment};
+    static constexpr const span_size_t size{major * stride};
+
+    static void store(
+      byte* dest,
+      const math::matrix<T, C, R, RM, V>& value) noexcept {
+        const auto elements{element_view(value)};
+        for(span_size_t i = 0; i < major; ++i) {
+            std::memcpy(
+              dest + i * stride,
+              elements.data() + i * minor,
+              std_size(minor * 4));
+        }
+    }
+};
+
+// in the std140 layout the elements of arrays are aligned to 16 bytes
+export template <typename T, std::size_t N, glsl_block_layout L>
+struct glsl_block_member<std::array<T, N>, L> {
+    using element = glsl_block_member<T, L>;
+    static constexpr const span_size_t alignment{
+      L == glsl_block_layout::std140 ? glsl_align_up(element::alignment, 16)
+                                     : element::alignment};
+    static constexpr const span_size_t stride{
+      glsl_align_up(element::size, alignment)};
+    static constexpr const span_size_t size{span_size(N) * stride};
+
+    static void store(byte* dest, const std::array<T, N>& value) noexcept {
+        for(std::size_t i = 0U; i < N; ++i) {
+            element::store(dest + span_size(i) * stride, value[i]);
+        }
+    }
+};
+//------------------------------------------------------------------------------
+template <glsl_block_layout L, typename... T>
+constexpr auto glsl_block_offsets() noexcept
+  -> std::array<span_size_t, sizeof...(T)> {
+    std::array<span_size_t, sizeof...(T)> result{};
+    span_size_t offs{0};
+    std::size_t i{0U};
+    ((offs = glsl_align_up(offs, glsl_block_member<T, L>::alignment),
+      result[i++] = offs,
+      offs += glsl_block_member<T, L>::size),
+     ...);
+    return result;
+}
+//------------------------------------------------------------------------------
+template <glsl_block_layout L, typename... T>
+constexpr auto glsl_block_size() noexcept -> span_size_t {
+    const auto offsets{glsl_block_offsets<L, T...>()};
+    span_size_t end{0};
+    span_size_t align{L == glsl_block_layout::std140 ? 16 : 4};
+    std::size_t i{0U};
+    ((end = offsets[i++] + glsl_block_member<T, L>::size,
+      align = std::max(align, glsl_block_member<T, L>::alignment)),
+     ...);
+    return glsl_align_up(end, align);
+}
+//------------------------------------------------------------------------------
+/// @brief Compile-time layout of a GLSL interface block with given members.
+/// @ingroup gl_utils
+/// @see std140_block
+/// @see std430_block
+/// @see uniform_buffer_ring
+///
+/// The member types are listed in the order of the declarations in the
+/// shader. The offsets and the size of the block are computed at compile
+/// time and the values of all members are stored into the buffer memory
+/// with a single call. Nested structures are not supported.
+export template <glsl_block_layout L, typename... T>
+class glsl_block {
+public:
+    /// @brief The number of block members.
+    static constexpr const std::size_t member_count{sizeof...(T)};
+
+    /// @brief The type of the I-th block member.
+    template <std::size_t I>
+    using member_type = std::tuple_element_t<I, std::tuple<T...>>;
+
+    /// @brief The byte offsets of the block members.
+    static constexpr const std::array<span_size_t, sizeof...(T)> offsets{
+      glsl_block_offsets<L, T...>()};
+
+    /// @brief The byte offset of the I-th block member.
+    template <std::size_t I>
+    static constexpr auto offset() noexcept -> span_size_t {
+        return offsets[I];
+    }
+
+    /// @brief The byte size of the block, including the trailing padding.
+    static constexpr const span_size_t size{glsl_block_size<L, T...>()};
+
+    /// @brief Stores the values of all members into the specified memory.
+    /// @pre dest.size() >= size
+    static void store(memory::block dest, const T&... values) noexcept {
+        assert(dest.size() >= size);
+        _store(dest.data(), std::index_sequence_for<T...>{}, values...);
+    }
+
+    /// @brief Stores the value of the I-th member into the specified memory.
+    /// @pre dest.size() >= size
+    template <std::size_t I>
+    static void store(
+      memory::block dest,
+      const member_type<I>& value) noexcept {
+        assert(dest.size() >= size);
+        glsl_block_member<member_type<I>, L>::store(
+          dest.data() + offsets[I], value);
+    }
+
+private:
+    template <std::size_t... I>
+    static void _store(
+      byte* dest,
+      std::index_sequence<I...>,
+      const T&... values) noexcept {
+        (glsl_block_member<T, L>::store(dest + offsets[I], values), ...);
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Alias for the std140 layout of a block with the specified members.
+/// @ingroup gl_utils
+export template <typename... T>
+using std140_block = glsl_block<glsl_block_layout::std140, T...>;
+
+/// @brief Alias for the std430 layout of a block with the specified members.
+/// @ingroup gl_utils
+export template <typename... T>
+using std430_block = glsl_block<glsl_block_layout::std430, T...>;
+//------------------------------------------------------------------------------
+/// @brief A range of a uniform_buffer_ring allocated for a single draw.
+/// @ingroup gl_utils
+/// @see uniform_buffer_ring
+export struct uniform_buffer_slice {
+    /// @brief The mapped memory of the slice.
+    memory::block data;
+    /// @brief The offset of the slice in the uniform buffer.
+    span_size_t offset{0};
+
+    /// @brief Indicates if the slice was allocated.
+    explicit operator bool() const noexcept {
+        return not data.empty();
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Persistently mapped uniform buffer, sub-allocated per draw.
+/// @ingroup gl_utils
+/// @see glsl_block
+/// @see mapped_buffer_ring
+///
+/// The buffer is split into per-frame segments. Each frame the block data
+/// of the individual draws is written into slices allocated from the
+/// current segment and each slice is bound with bind_buffer_range, so all
+/// uniforms of a block are updated with a single copy and a single bind.
+/// A segment is reused only after the GPU finished the frame that used it.
+/// If persistent mapping is not supported, init fails and the uniforms
+/// have to be set one by one.
+export class uniform_buffer_ring {
+public:
+    /// @brief Construction with the specified segment byte size and count.
+    uniform_buffer_ring(
+      const span_size_t segment_size,
+      const span_size_t segment_count) noexcept
+      : _ring{segment_size, segment_count} {}
+
+    uniform_buffer_ring(uniform_buffer_ring&&) noexcept = default;
+    uniform_buffer_ring(const uniform_buffer_ring&) = delete;
+    auto operator=(uniform_buffer_ring&&) noexcept
+      -> uniform_buffer_ring& = default;
+    auto operator=(const uniform_buffer_ring&) = delete;
+    ~uniform_buffer_ring() noexcept = default;
+
+    /// @brief Creates and persistently maps the buffer storage.
+    auto init(const gl_api& glapi) -> bool;
+
+    /// @brief Indicates if the ring buffer is created and mapped.
+    auto is_initialized() const noexcept -> bool {
+        return _ring.is_initialized();
+    }
+
+    /// @brief Indicates if the ring buffer is created and mapped.
+    /// @see is_initialized
+    explicit operator bool() const noexcept {
+        return is_initialized();
+    }
+
+    /// @brief Returns the byte size of a single segment.
+    auto segment_size() const noexcept -> span_size_t {
+        return _ring.segment_size();
+    }
+
+    /// @brief Returns the number of segments.
+    auto segment_count() const noexcept -> span_size_t {
+        return _ring.segment_count();
+    }
+
+    /// @brief Returns the alignment of the slice offsets.
+    auto alignment() const noexcept -> span_size_t {
+        return _alignment;
+    }
+
+    /// @brief Returns the name of the uniform buffer.
+    auto buffer() const noexcept -> buffer_name {
+        return _ring.buffer();
+    }
+
+    /// @brief Starts using the next segment for the slices of a new frame.
+    /// @see end_frame
+    ///
+    /// Waits for the GPU to finish reading from the segment if necessary.
+    void begin_frame(const gl_api& glapi) noexcept;
+
+    /// @brief Allocates a slice with the specified size in the current segment.
+    /// @see begin_frame
+    /// @post not result if the segment is full or if there is no segment.
+    auto allocate(const span_size_t size) noexcept -> uniform_buffer_slice;
+
+    /// @brief Allocates a slice for the block and stores the member values.
+    /// @see glsl_block
+    template <typename Block, typename... T>
+    auto store(const T&... values) noexcept -> uniform_buffer_slice {
+        const auto slice{allocate(Block::size)};
+        if(slice) {
+            Block::store(slice.data, values...);
+        }
+        return slice;
+    }
+
+    /// @brief Binds the specified slice to the uniform buffer binding point.
+    void bind(
+      const gl_api& glapi,
+      const gl_types::uint_type binding,
+      const uniform_buffer_slice& slice) const noexcept;
+
+    /// @brief Marks the end of GL commands reading the current segment.
+    /// @see begin_frame
+    void end_frame(const gl_api& glapi) noexcept;
+
+    /// @brief Returns how many times begin_frame had to wait for the GPU.
+    auto stall_count() const noexcept -> span_size_t {
+        return _ring.stall_count();
+    }
+
+    /// @brief Unmaps and deletes the buffer and the pending fences.
+    void clean_up(const gl_api& glapi);
+
+private:
+    mapped_buffer_ring _ring;
+    span_size_t _alignment{256};
+    span_size_t _segment{-1};
+    span_size_t _used{0};
+};
+//------------------------------------------------------------------------------
+} // namespace eagine::oglplus
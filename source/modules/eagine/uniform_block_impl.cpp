@@ -0,0 +1,71 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+
+module eagine.oglplus;
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+
+namespace eagine::oglplus {
+//------------------------------------------------------------------------------
+// uniform_buffer_ring
+//------------------------------------------------------------------------------
+auto uniform_buffer_ring::init(const gl_api& glapi) -> bool {
+    const auto& [gl, GL] = glapi;
+    if(const auto alignment{
+         gl.get_integer(GL.uniform_buffer_offset_alignment).value_or(0)};
+       alignment > 0) {
+        _alignment = span_size(alignment);
+    }
+    // all segments start at an aligned offset
+    _ring.align_segments(_alignment);
+    return _ring.init(glapi);
+}
+//------------------------------------------------------------------------------
+void uniform_buffer_ring::begin_frame(const gl_api& glapi) noexcept {
+    _segment = _ring.acquire(glapi);
+    _used = 0;
+}
+//------------------------------------------------------------------------------
+auto uniform_buffer_ring::allocate(const span_size_t size) noexcept
+  -> uniform_buffer_slice {
+    const auto offs{((_used + _alignment - 1) / _alignment) * _alignment};
+    if(
+      not is_initialized() or (_segment < 0) or (size <= 0) or
+      (offs + size > segment_size())) {
+        return {};
+    }
+    _used = offs + size;
+    return {
+      .data = {_ring.segment(_segment).data() + offs, size},
+      .offset = _ring.segment_offset(_segment) + offs};
+}
+//------------------------------------------------------------------------------
+void uniform_buffer_ring::bind(
+  const gl_api& glapi,
+  const gl_types::uint_type binding,
+  const uniform_buffer_slice& slice) const noexcept {
+    const auto& [gl, GL] = glapi;
+    gl.bind_buffer_range(
+      GL.uniform_buffer,
+      binding,
+      _ring.buffer(),
+      limit_cast<gl_types::intptr_type>(slice.offset),
+      limit_cast<gl_types::sizeiptr_type>(slice.data.size()));
+}
+//------------------------------------------------------------------------------
+void uniform_buffer_ring::end_frame(const gl_api& glapi) noexcept {
+    _ring.release(glapi, _segment);
+}
+//------------------------------------------------------------------------------
+void uniform_buffer_ring::clean_up(const gl_api& glapi) {
+    _ring.clean_up(glapi);
+    _segment = -1;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::oglplus
@@ -0,0 +1,224 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+
+#include <eagine/testing/unit_begin_ctx.hpp>
+import std;
+import eagine.core;
+import eagine.oglplus;
+//------------------------------------------------------------------------------
+void uniform_block_std140_layout(auto& s) {
+    eagitest::case_ test{s, 1, "std140 layout"};
+    using namespace eagine::oglplus;
+
+    using block = std140_block<
+      mat4,
+      vec3,
+      float,
+      vec2,
+      std::array<float, 3>,
+      bool>;
+
+    test.check_equal(block::offset<0>(), 0, "mat4");
+    test.check_equal(block::offset<1>(), 64, "vec3");
+    test.check_equal(block::offset<2>(), 76, "float after vec3");
+    test.check_equal(block::offset<3>(), 80, "vec2");
+    test.check_equal(block::offset<4>(), 96, "float array");
+    test.check_equal(block::offset<5>(), 144, "bool");
+    test.check_equal(block::size, 160, "size");
+}
+//------------------------------------------------------------------------------
+void uniform_block_std430_layout(auto& s) {
+    eagitest::case_ test{s, 2, "std430 layout"};
+    using namespace eagine::oglplus;
+
+    using block = std430_block<
+      mat4,
+      vec3,
+      float,
+      vec2,
+      std::array<float, 3>,
+      bool>;
+
+    test.check_equal(block::offset<3>(), 80, "vec2");
+    test.check_equal(block::offset<4>(), 88, "float array");
+    test.check_equal(block::offset<5>(), 100, "bool");
+    test.check_equal(block::size, 112, "size");
+}
+//------------------------------------------------------------------------------
+void uniform_block_store(auto& s) {
+    eagitest::case_ test{s, 3, "store"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    using block = std140_block<vec3, float, std::array<float, 2>>;
+    std::vector<byte> data(std_size(block::size));
+    block::store(
+      cover(data), vec3(1.F, 2.F, 3.F), 4.F, std::array<float, 2>{5.F, 6.F});
+
+    const auto read{[&](span_size_t offset) {
+        float value{0.F};
+        std::memcpy(&value, data.data() + offset, sizeof(value));
+        return value;
+    }};
+    test.check_equal(read(0), 1.F, "x");
+    test.check_equal(read(8), 3.F, "z");
+    test.check_equal(read(12), 4.F, "float");
+    test.check_equal(read(16), 5.F, "array 0");
+    test.check_equal(read(32), 6.F, "array 1");
+
+    block::store<1>(cover(data), 7.F);
+    test.check_equal(read(12), 7.F, "single member");
+}
+//------------------------------------------------------------------------------
+void uniform_block_ring_unmapped(auto& s) {
+    eagitest::case_ test{s, 4, "uniform buffer ring without mapping"};
+    using namespace eagine::oglplus;
+
+    // the recording stubs return null from map_buffer_range
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+
+    uniform_buffer_ring ring{1000, 3};
+    test.check(not ring.init(glapi), "not initialized");
+    test.check_equal(ring.segment_size(), 1024, "aligned segment size");
+    test.check_equal(
+      recorder.call_count("GenBuffers"),
+      recorder.call_count("DeleteBuffers"),
+      "buffer cleaned up");
+
+    ring.begin_frame(glapi);
+    test.check(not ring.allocate(64), "nothing allocated");
+    ring.end_frame(glapi);
+    ring.clean_up(glapi);
+
+    // a ring without segments has nothing to cycle through
+    uniform_buffer_ring empty{1000, 0};
+    test.check(not empty.init(glapi), "no segments");
+    empty.begin_frame(glapi);
+    test.check(not empty.allocate(64), "no segment");
+    empty.end_frame(glapi);
+    empty.clean_up(glapi);
+}
+//------------------------------------------------------------------------------
+void uniform_block_matrix_store(auto& s) {
+    eagitest::case_ test{s, 5, "matrix store"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    // the mat3 columns are padded to 16 bytes
+    using block = std140_block<mat3, float>;
+    test.check_equal(block::offset<1>(), 48, "float after mat3");
+    test.check_equal(block::size, 64, "size");
+
+    std::vector<byte> data(std_size(block::size));
+    const float padding{-1.F};
+    for(span_size_t offs = 0; offs < block::size; offs += 4) {
+        std::memcpy(data.data() + offs, &padding, sizeof(padding));
+    }
+    block::store(cover(data), math::identity<mat3>{}(), 2.F);
+
+    const auto read{[&](span_size_t offset) {
+        float value{0.F};
+        std::memcpy(&value, data.data() + offset, sizeof(value));
+        return value;
+    }};
+    for(span_size_t c = 0; c < 3; ++c) {
+        for(span_size_t r = 0; r < 3; ++r) {
+            test.check_equal(
+              read(c * 16 + r * 4), c == r ? 1.F : 0.F, "element");
+        }
+        test.check_equal(read(c * 16 + 12), padding, "column padding");
+    }
+    test.check_equal(read(48), 2.F, "float");
+    test.check_equal(read(52), padding, "block padding");
+}
+//------------------------------------------------------------------------------
+void uniform_block_ring_mapped(auto& s) {
+    eagitest::case_ test{s, 6, "mapped uniform buffer ring"};
+    using namespace eagine;
+    using namespace eagine::oglplus;
+
+    gl_command_recorder recorder;
+    const gl_api glapi{s.context(), recording_gl_api_traits{recorder}};
+
+    std::vector<byte> storage(3 * 1024, byte(0));
+    int fence{0};
+    recorder.set_result("GetIntegerv", 64)
+      .set_pointer_result("MapNamedBufferRange", storage.data())
+      .set_pointer_result("MapBufferRange", storage.data())
+      .set_pointer_result("FenceSync", &fence);
+
+    uniform_buffer_ring ring{1000, 3};
+    test.check(ring.init(glapi), "initialized");
+    test.check_equal(ring.alignment(), 64, "alignment");
+    test.check_equal(ring.segment_size(), 1024, "aligned segment size");
+    test.check_equal(recorder.call_count("CreateBuffers"), 1, "created");
+    test.check_equal(recorder.call_count("GenBuffers"), 0, "not generated");
+
+    // the first frame uses the first segment
+    ring.begin_frame(glapi);
+    const auto first{ring.allocate(10)};
+    const auto second{ring.allocate(10)};
+    test.check(bool(first), "first allocated");
+    test.check(bool(second), "second allocated");
+    test.check_equal(first.offset, 0, "first offset");
+    test.check_equal(second.offset, 64, "aligned offset");
+    test.check(first.data.data() == storage.data(), "first mapped");
+    test.check(second.data.data() == storage.data() + 64, "second mapped");
+    test.check(not ring.allocate(1000), "segment full");
+
+    const auto slice{ring.store<std140_block<float, float>>(3.F, 4.F)};
+    test.check_equal(slice.offset, 128, "stored offset");
+    float value{0.F};
+    std::memcpy(&value, storage.data() + 132, sizeof(value));
+    test.check_equal(value, 4.F, "stored value");
+    ring.bind(glapi, 0U, slice);
+    test.check_equal(recorder.call_count("BindBufferRange"), 1, "bound");
+    ring.end_frame(glapi);
+    test.check_equal(recorder.call_count("FenceSync"), 1, "fenced");
+
+    // the next frames use the other segments
+    ring.begin_frame(glapi);
+    test.check_equal(ring.allocate(10).offset, 1024, "second segment");
+    ring.end_frame(glapi);
+    ring.begin_frame(glapi);
+    test.check_equal(ring.allocate(10).offset, 2048, "third segment");
+    ring.end_frame(glapi);
+    test.check_equal(recorder.call_count("ClientWaitSync"), 0, "no waits");
+
+    // the first segment is reused after its fence is waited on
+    ring.begin_frame(glapi);
+    test.check_equal(recorder.call_count("ClientWaitSync"), 1, "waited");
+    test.check_equal(recorder.call_count("DeleteSync"), 1, "fence deleted");
+    test.check_equal(ring.stall_count(), 0, "no stalls");
+    test.check_equal(ring.allocate(10).offset, 0, "first segment reused");
+    ring.end_frame(glapi);
+
+    recorder.clear();
+    ring.clean_up(glapi);
+    test.check_equal(recorder.call_count("DeleteSync"), 3, "fences deleted");
+    test.check_equal(
+      recorder.call_count("UnmapNamedBuffer") +
+        recorder.call_count("UnmapBuffer"),
+      1,
+      "unmapped");
+    test.check(not ring.is_initialized(), "cleaned up");
+}
+//------------------------------------------------------------------------------
+auto test_main(eagine::test_ctx& ctx) -> int {
+    eagitest::ctx_suite test{ctx, "uniform_block", 6};
+    test.once(uniform_block_std140_layout);
+    test.once(uniform_block_std430_layout);
+    test.once(uniform_block_store);
+    test.once(uniform_block_ring_unmapped);
+    test.once(uniform_block_matrix_store);
+    test.once(uniform_block_ring_mapped);
+    return test.exit_code();
+}
+//------------------------------------------------------------------------------
+#include <eagine/testing/unit_end_ctx.hpp>